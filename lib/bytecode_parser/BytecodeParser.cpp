@@ -1,6 +1,7 @@
 #include "BytecodeParser.hpp"
 
 #include <ranges>
+#include <utility>
 
 #include "lib/execution_tree/FunctionRepository.hpp"
 #include "lib/executor/IJitExecutorFactory.hpp"
@@ -18,8 +19,9 @@ namespace ovum::bytecode::parser {
 
 BytecodeParser::BytecodeParser(std::unique_ptr<vm::executor::IJitExecutorFactory> jit_factory,
                                size_t jit_boundary,
-                               const ICommandFactory& command_factory) :
-    jit_factory_(std::move(jit_factory)), jit_boundary_(jit_boundary) {
+                               const ICommandFactory& command_factory,
+                               bool pack_field_layouts) :
+    jit_factory_(std::move(jit_factory)), jit_boundary_(jit_boundary), pack_field_layouts_(pack_field_layouts) {
   handlers_.push_back(std::make_unique<InitStaticParser>(command_factory));
   handlers_.push_back(std::make_unique<VtableParser>());
   handlers_.push_back(std::make_unique<FunctionParser>(command_factory));
@@ -32,12 +34,15 @@ std::expected<std::unique_ptr<vm::execution_tree::Block>, BytecodeParserError> B
     const std::vector<TokenPtr>& tokens,
     vm::execution_tree::FunctionRepository& func_repo,
     vm::runtime::VirtualTableRepository& vtable_repo,
-    vm::runtime::RuntimeMemory& memory) {
+    vm::runtime::RuntimeMemory& memory,
+    std::optional<std::reference_wrapper<vm::runtime::StringPool>> string_pool) {
   ParsingSessionData data{.func_repo = func_repo,
                           .vtable_repo = vtable_repo,
                           .memory = memory,
                           .jit_factory = jit_factory_ ? std::optional(std::ref(*jit_factory_)) : std::nullopt,
-                          .jit_boundary = jit_boundary_};
+                          .string_pool = string_pool,
+                          .jit_boundary = jit_boundary_,
+                          .pack_field_layouts = pack_field_layouts_};
 
   std::shared_ptr<ParsingSession> session = std::make_shared<ParsingSession>(tokens, data);
 
@@ -67,7 +72,37 @@ std::expected<std::unique_ptr<vm::execution_tree::Block>, BytecodeParserError> B
     }
   }
 
+  // Functions may be declared before or after their vtable, so empty destructors are matched and method slots are
+  // bound once everything is parsed
+  for (size_t i = 0; i < vtable_repo.GetCount(); ++i) {
+    std::expected<vm::runtime::VirtualTable*, std::runtime_error> vtable = vtable_repo.GetByIndex(i);
+
+    if (!vtable.has_value()) {
+      continue;
+    }
+
+    vtable.value()->BindSlots(func_repo);
+
+    std::expected<vm::runtime::FunctionId, std::runtime_error> dtor_id =
+        vtable.value()->GetRealFunctionId("_destructor_<M>");
+
+    if (dtor_id.has_value() && session->IsEmptyFunction(dtor_id.value())) {
+      vtable.value()->SetTriviallyDestructible(true);
+    }
+  }
+
+  fused_allocations_ = std::move(data.fused_allocations);
+  packed_layouts_ = std::move(data.packed_layouts);
+
   return session->GetInitStaticBlock();
 }
 
+const std::vector<FusedAllocation>& BytecodeParser::GetFusedAllocations() const {
+  return fused_allocations_;
+}
+
+const std::vector<PackedClassLayout>& BytecodeParser::GetPackedLayouts() const {
+  return packed_layouts_;
+}
+
 } // namespace ovum::bytecode::parser
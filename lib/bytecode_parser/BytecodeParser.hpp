@@ -2,7 +2,9 @@
 #define BYTECODE_PARSER_BYTECODEPARSER_HPP_
 
 #include <expected>
+#include <functional>
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include "lib/executor/IJitExecutorFactory.hpp"
@@ -18,18 +20,28 @@ class BytecodeParser {
 public:
   BytecodeParser(std::unique_ptr<vm::executor::IJitExecutorFactory> jit_factory,
                  size_t jit_boundary,
-                 const ICommandFactory& command_factory);
+                 const ICommandFactory& command_factory,
+                 bool pack_field_layouts = false);
 
   std::expected<std::unique_ptr<vm::execution_tree::Block>, BytecodeParserError> Parse(
       const std::vector<TokenPtr>& tokens,
       vm::execution_tree::FunctionRepository& func_repo,
       vm::runtime::VirtualTableRepository& vtable_repo,
-      vm::runtime::RuntimeMemory& memory);
+      vm::runtime::RuntimeMemory& memory,
+      std::optional<std::reference_wrapper<vm::runtime::StringPool>> string_pool = std::nullopt);
+
+  // Allocations fused with the command that consumes them during the last Parse call
+  [[nodiscard]] const std::vector<FusedAllocation>& GetFusedAllocations() const;
+  // User classes repacked during the last Parse call; empty unless field layout packing is enabled
+  [[nodiscard]] const std::vector<PackedClassLayout>& GetPackedLayouts() const;
 
 private:
   std::vector<std::unique_ptr<IParserHandler>> handlers_;
   std::unique_ptr<vm::executor::IJitExecutorFactory> jit_factory_;
   size_t jit_boundary_;
+  bool pack_field_layouts_;
+  std::vector<FusedAllocation> fused_allocations_;
+  std::vector<PackedClassLayout> packed_layouts_;
 };
 
 } // namespace ovum::bytecode::parser
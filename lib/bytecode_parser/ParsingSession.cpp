@@ -1,5 +1,7 @@
 #include "ParsingSession.hpp"
 
+#include <utility>
+
 #include <tokens/EofToken.hpp>
 #include <tokens/LiteralToken.hpp>
 #include <tokens/values/StringValue.hpp>
@@ -27,6 +29,9 @@ const std::optional<std::reference_wrapper<vm::executor::IJitExecutorFactory>>&
 [[nodiscard]] size_t ParsingSession::GetJitBoundary() const {
   return data_.jit_boundary;
 }
+const std::optional<std::reference_wrapper<vm::runtime::StringPool>>& ParsingSession::GetStringPool() const {
+  return data_.string_pool;
+}
 
 std::unique_ptr<vm::execution_tree::Block> ParsingSession::GetInitStaticBlock() {
   return std::move(data_.init_static_block);
@@ -35,6 +40,37 @@ void ParsingSession::SetInitStaticBlock(std::unique_ptr<vm::execution_tree::Bloc
   data_.init_static_block = std::move(block);
 }
 
+void ParsingSession::AddEmptyFunction(const std::string& name) {
+  data_.empty_functions.insert(name);
+}
+
+bool ParsingSession::IsEmptyFunction(const std::string& name) const {
+  return data_.empty_functions.contains(name);
+}
+
+const std::string& ParsingSession::GetCurrentFunctionName() const {
+  return data_.current_function_name;
+}
+void ParsingSession::SetCurrentFunctionName(const std::string& name) {
+  data_.current_function_name = name;
+}
+
+void ParsingSession::AddFusedAllocation(FusedAllocation site) {
+  data_.fused_allocations.push_back(std::move(site));
+}
+
+const std::vector<FusedAllocation>& ParsingSession::GetFusedAllocations() const {
+  return data_.fused_allocations;
+}
+
+bool ParsingSession::IsFieldLayoutPackingEnabled() const {
+  return data_.pack_field_layouts;
+}
+
+void ParsingSession::AddPackedLayout(PackedClassLayout layout) {
+  data_.packed_layouts.push_back(std::move(layout));
+}
+
 ParsingSession::ParsingSession(const std::vector<TokenPtr>& tokens, ParsingSessionData& data) :
     tokens_(tokens), data_(data) {
 }
@@ -42,10 +42,23 @@ public:
 
   [[nodiscard]] const std::optional<std::reference_wrapper<vm::executor::IJitExecutorFactory>>& GetJitFactory() const;
   [[nodiscard]] size_t GetJitBoundary() const;
+  [[nodiscard]] const std::optional<std::reference_wrapper<vm::runtime::StringPool>>& GetStringPool() const;
 
   std::unique_ptr<vm::execution_tree::Block> GetInitStaticBlock();
   void SetInitStaticBlock(std::unique_ptr<vm::execution_tree::Block> block);
 
+  void AddEmptyFunction(const std::string& name);
+  [[nodiscard]] bool IsEmptyFunction(const std::string& name) const;
+
+  [[nodiscard]] const std::string& GetCurrentFunctionName() const;
+  void SetCurrentFunctionName(const std::string& name);
+
+  void AddFusedAllocation(FusedAllocation site);
+  [[nodiscard]] const std::vector<FusedAllocation>& GetFusedAllocations() const;
+
+  [[nodiscard]] bool IsFieldLayoutPackingEnabled() const;
+  void AddPackedLayout(PackedClassLayout layout);
+
   std::vector<TokenPtr> CopyUntilBlockEnd();
 
 private:
@@ -3,15 +3,35 @@
 
 #include <memory>
 #include <optional>
+#include <string>
+#include <unordered_set>
+#include <vector>
 
 #include "lib/execution_tree/Block.hpp"
 #include "lib/execution_tree/FunctionRepository.hpp"
 #include "lib/executor/IJitExecutorFactory.hpp"
 #include "lib/runtime/RuntimeMemory.hpp"
+#include "lib/runtime/StringPool.hpp"
 #include "lib/runtime/VirtualTableRepository.hpp"
 
 namespace ovum::bytecode::parser {
 
+// An allocation replaced together with its only consumer by a fused command that allocates nothing
+struct FusedAllocation {
+  std::string function_name;
+  size_t line = 0;
+  std::string allocation;
+  std::string consumer;
+};
+
+// A user class whose fields were reordered by alignment to drop padding; field indices are unchanged
+struct PackedClassLayout {
+  std::string class_name;
+  size_t field_count = 0;
+  size_t declared_size = 0;
+  size_t packed_size = 0;
+};
+
 struct ParsingSessionData {
   vm::execution_tree::FunctionRepository& func_repo;
   vm::runtime::VirtualTableRepository& vtable_repo;
@@ -19,9 +39,15 @@ struct ParsingSessionData {
 
   std::unique_ptr<vm::execution_tree::Block> init_static_block;
   vm::execution_tree::Block* current_block = nullptr;
+  std::unordered_set<std::string> empty_functions;
+  std::string current_function_name;
+  std::vector<FusedAllocation> fused_allocations;
+  std::vector<PackedClassLayout> packed_layouts;
 
   std::optional<std::reference_wrapper<vm::executor::IJitExecutorFactory>> jit_factory;
+  std::optional<std::reference_wrapper<vm::runtime::StringPool>> string_pool;
   size_t jit_boundary = 0;
+  bool pack_field_layouts = false;
 };
 
 } // namespace ovum::bytecode::parser
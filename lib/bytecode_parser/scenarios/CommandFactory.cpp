@@ -1,5 +1,7 @@
 #include "CommandFactory.hpp"
 
+#include <utility>
+
 #include "lib/execution_tree/command_factory.hpp"
 
 #include "lib/bytecode_parser/BytecodeParserError.hpp"
@@ -28,6 +30,19 @@ std::expected<std::unique_ptr<vm::execution_tree::IExecutable>, BytecodeParserEr
       return std::unexpected(value.error());
     }
 
+    // With the run's pool at hand every literal is interned now, so executing the command is a single push
+    if (ctx->GetStringPool().has_value()) {
+      std::expected<void*, std::runtime_error> string_obj =
+          ctx->GetStringPool()->get().Intern(value.value(), ctx->GetVTableRepo());
+
+      if (!string_obj) {
+        return std::unexpected(BytecodeParserError("Failed to intern string literal: " +
+                                                   std::string(string_obj.error().what())));
+      }
+
+      return vm::execution_tree::CreateInternedStringCommand(string_obj.value());
+    }
+
     std::expected<std::unique_ptr<vm::execution_tree::IExecutable>, std::out_of_range> cmd =
         vm::execution_tree::CreateStringCommandByName(cmd_name, value.value());
 
@@ -90,12 +105,21 @@ std::expected<std::unique_ptr<vm::execution_tree::IExecutable>, BytecodeParserEr
   }
 
   if (kIdentCommands.contains(cmd_name)) {
+    size_t line = ctx->Current()->GetPosition().GetLine();
     std::expected<std::string, BytecodeParserError> ident = ctx->ConsumeIdentifier();
 
     if (!ident) {
       return std::unexpected(ident.error());
     }
 
+    if (cmd_name == "CallConstructor") {
+      std::unique_ptr<vm::execution_tree::IExecutable> fused = TryFuseAllocation(ident.value(), line, ctx);
+
+      if (fused != nullptr) {
+        return fused;
+      }
+    }
+
     std::expected<std::unique_ptr<vm::execution_tree::IExecutable>, std::out_of_range> cmd =
         vm::execution_tree::CreateStringCommandByName(cmd_name, ident.value());
 
@@ -123,6 +147,15 @@ std::expected<std::unique_ptr<vm::execution_tree::IExecutable>, BytecodeParserEr
     return std::move(cmd.value());
   }
 
+  if (cmd_name == "PushNull") {
+    std::unique_ptr<vm::execution_tree::IExecutable> fused =
+        TryFuseAllocation(cmd_name, ctx->Current()->GetPosition().GetLine(), ctx);
+
+    if (fused != nullptr) {
+      return fused;
+    }
+  }
+
   std::expected<std::unique_ptr<vm::execution_tree::IExecutable>, std::out_of_range> cmd =
       vm::execution_tree::CreateSimpleCommandByName(cmd_name);
 
@@ -133,4 +166,28 @@ std::expected<std::unique_ptr<vm::execution_tree::IExecutable>, BytecodeParserEr
   return std::move(cmd.value());
 }
 
+std::unique_ptr<vm::execution_tree::IExecutable> CommandFactory::TryFuseAllocation(
+    const std::string& allocation, size_t line, const std::shared_ptr<ParsingSession>& ctx) {
+  // Only the very next command can match, so no branch, loop or block boundary lies between the two
+  if (ctx->IsEof() || (ctx->Current()->GetStringType() != "IDENT" && ctx->Current()->GetStringType() != "KEYWORD")) {
+    return nullptr;
+  }
+
+  std::string consumer = ctx->Current()->GetLexeme();
+  std::expected<std::unique_ptr<vm::execution_tree::IExecutable>, std::out_of_range> fused =
+      vm::execution_tree::CreateFusedAllocationCommand(allocation, consumer);
+
+  if (!fused) {
+    return nullptr;
+  }
+
+  ctx->Advance();
+  ctx->AddFusedAllocation(FusedAllocation{.function_name = ctx->GetCurrentFunctionName(),
+                                          .line = line,
+                                          .allocation = allocation,
+                                          .consumer = std::move(consumer)});
+
+  return std::move(fused.value());
+}
+
 } // namespace ovum::bytecode::parser
@@ -22,6 +22,10 @@ public:
       const std::string& cmd_name, std::shared_ptr<ParsingSession> ctx) const override;
 
 private:
+  // Fuses an allocation with the command that follows it when the object cannot escape in between
+  static std::unique_ptr<vm::execution_tree::IExecutable> TryFuseAllocation(
+      const std::string& allocation, size_t line, const std::shared_ptr<ParsingSession>& ctx);
+
   static const std::unordered_set<std::string> kStringCommands;
   static const std::unordered_set<std::string> kIntegerCommands;
   static const std::unordered_set<std::string> kFloatCommands;
@@ -96,6 +96,7 @@ std::expected<bool, BytecodeParserError> FunctionParser::Handle(ParsingSessionPt
   }
 
   ctx->SetCurrentBlock(body.get());
+  ctx->SetCurrentFunctionName(name_res.value());
 
   while (!ctx->IsPunct('}') && !ctx->IsEof()) {
     std::expected<bool, BytecodeParserError> res = CommandParser::ParseSingleStatement(ctx, *body, factory_);
@@ -115,6 +116,11 @@ std::expected<bool, BytecodeParserError> FunctionParser::Handle(ParsingSessionPt
   }
 
   ctx->SetCurrentBlock(nullptr);
+  ctx->SetCurrentFunctionName("");
+
+  if (body->IsEmpty()) {
+    ctx->AddEmptyFunction(name_res.value());
+  }
 
   FunctionFactory factory(ctx->GetJitFactory(), ctx->GetJitBoundary());
 
@@ -1,5 +1,12 @@
 #include "VtableParser.hpp"
 
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "lib/runtime/FieldInfo.hpp"
 #include "lib/runtime/VirtualTable.hpp"
 
 #include "FunctionFactory.hpp"
@@ -7,6 +14,42 @@
 
 namespace ovum::bytecode::parser {
 
+namespace {
+
+constexpr int64_t kMaxFieldAlignment = sizeof(void*);
+
+struct DeclaredField {
+  std::string type_name;
+  vm::runtime::FieldType type;
+  int64_t offset;
+};
+
+int64_t AlignUp(int64_t offset, int64_t alignment) {
+  return (offset + alignment - 1) / alignment * alignment;
+}
+
+// Lays the fields out again from the lowest declared offset, widest first and in declaration order among fields of
+// equal size, so only the tail of the object is padded. Returns the packed object size
+size_t PackFields(std::vector<DeclaredField>& fields) {
+  std::vector<size_t> order(fields.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::ranges::stable_sort(
+      order, std::greater{}, [&fields](size_t i) { return vm::runtime::GetFieldSize(fields[i].type); });
+
+  int64_t offset = std::ranges::min(fields, {}, &DeclaredField::offset).offset;
+
+  for (size_t i : order) {
+    const auto size = static_cast<int64_t>(vm::runtime::GetFieldSize(fields[i].type));
+    offset = AlignUp(offset, size);
+    fields[i].offset = offset;
+    offset += size;
+  }
+
+  return static_cast<size_t>(AlignUp(offset, kMaxFieldAlignment));
+}
+
+} // namespace
+
 std::expected<bool, BytecodeParserError> VtableParser::Handle(std::shared_ptr<ParsingSession> ctx) {
   if (!ctx->IsKeyword("vtable")) {
     return false;
@@ -33,6 +76,7 @@ std::expected<bool, BytecodeParserError> VtableParser::Handle(std::shared_ptr<Pa
   }
 
   vm::runtime::VirtualTable vtable(class_name, 0);
+  std::vector<DeclaredField> fields;
 
   while (!ctx->IsPunct('}') && !ctx->IsEof()) {
     if (ctx->IsKeyword("size")) {
@@ -166,7 +210,14 @@ std::expected<bool, BytecodeParserError> VtableParser::Handle(std::shared_ptr<Pa
           return std::unexpected(offset.error());
         }
 
-        vtable.AddField(type.value(), offset.value());
+        std::expected<vm::runtime::FieldType, std::runtime_error> field_type =
+            vm::runtime::VirtualTable::GetFieldType(type.value());
+
+        if (!field_type) {
+          return std::unexpected(BytecodeParserError(field_type.error().what()));
+        }
+
+        fields.push_back({.type_name = type.value(), .type = field_type.value(), .offset = offset.value()});
 
         if (ctx->IsPunct(',')) {
           ctx->Advance();
@@ -189,6 +240,25 @@ std::expected<bool, BytecodeParserError> VtableParser::Handle(std::shared_ptr<Pa
     return std::unexpected(e.error());
   }
 
+  // Field indices stay in declaration order, so GetField and SetField operands are unaffected by the new offsets
+  if (ctx->IsFieldLayoutPackingEnabled() && !fields.empty()) {
+    std::vector<DeclaredField> packed = fields;
+    const size_t packed_size = PackFields(packed);
+
+    if (packed_size < vtable.GetSize()) {
+      ctx->AddPackedLayout(PackedClassLayout{.class_name = class_name,
+                                             .field_count = fields.size(),
+                                             .declared_size = vtable.GetSize(),
+                                             .packed_size = packed_size});
+      fields = std::move(packed);
+      vtable.SetSize(packed_size);
+    }
+  }
+
+  for (const DeclaredField& field : fields) {
+    vtable.AddField(field.type_name, field.offset);
+  }
+
   // Check if vtable with this name already exists before adding
   auto existing_vtable = ctx->GetVTableRepo().GetByName(class_name);
   if (existing_vtable.has_value()) {
@@ -217,6 +287,7 @@ std::expected<bool, BytecodeParserError> VtableParser::Handle(std::shared_ptr<Pa
     }
 
     vtable.AddFunction(dtor_virtual_name, dtor_real_name);
+    vtable.SetTriviallyDestructible(true);
   }
 
   if (!ctx->GetVTableRepo().Add(std::move(vtable))) {
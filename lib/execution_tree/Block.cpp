@@ -8,6 +8,10 @@ void Block::AddStatement(std::unique_ptr<IExecutable> statement) {
   statements_.emplace_back(std::move(statement));
 }
 
+bool Block::IsEmpty() const {
+  return statements_.empty();
+}
+
 std::expected<ExecutionResult, std::runtime_error> Block::Execute(PassedExecutionData& execution_data) {
   for (const auto& statement : statements_) {
     const std::expected<ExecutionResult, std::runtime_error> result = statement->Execute(execution_data);
@@ -13,6 +13,7 @@ public:
   Block();
 
   void AddStatement(std::unique_ptr<IExecutable> statement);
+  [[nodiscard]] bool IsEmpty() const;
 
   std::expected<ExecutionResult, std::runtime_error> Execute(PassedExecutionData& execution_data) override;
 
@@ -17,7 +17,9 @@
 #include "IFunctionExecutable.hpp"
 #include "lib/executor/BuiltinFunctions.hpp"
 #include "lib/runtime/ByteArray.hpp"
+#include "lib/runtime/MethodSlots.hpp"
 #include "lib/runtime/ObjectDescriptor.hpp"
+#include "lib/runtime/TypeIds.hpp"
 
 #ifdef _WIN32
 #include <windows.h>
@@ -39,6 +41,8 @@ namespace ovum::vm::execution_tree::bytecode {
 
 static std::mt19937_64 runtime_random_engine(std::random_device{}()); // NOLINT
 
+constexpr std::chrono::milliseconds kBlockingReadIdleBudget{10};
+
 template<typename ArgumentType>
 std::expected<ArgumentType, std::runtime_error> TryExtractArgument(PassedExecutionData& data,
                                                                    const std::string& function_name) {
@@ -74,6 +78,83 @@ std::expected<std::pair<ArgumentOneType, ArgumentTwoType>, std::runtime_error> T
   return std::pair<ArgumentOneType, ArgumentTwoType>(*argument_one, *argument_two);
 }
 
+// Sleeping is an idle point: collector work runs first and only the rest of the duration is slept
+static std::expected<ExecutionResult, std::runtime_error> SleepWhileCollecting(PassedExecutionData& data,
+                                                                               std::chrono::nanoseconds duration) {
+  const auto start = std::chrono::steady_clock::now();
+  std::expected<void, std::runtime_error> gc_res = data.memory_manager.CollectGarbageWhileIdle(data, duration);
+
+  if (!gc_res.has_value()) {
+    return std::unexpected(gc_res.error());
+  }
+
+  std::this_thread::sleep_for(duration - (std::chrono::steady_clock::now() - start));
+
+  return ExecutionResult::kNormal;
+}
+
+// A shared box leaving its Nullable is copied, so the program never holds an object whose value other holders see
+static std::expected<void*, std::runtime_error> CopyIfShared(PassedExecutionData& data, void* obj) {
+  if (!runtime::BoxCache::IsImmortal(obj)) {
+    return obj;
+  }
+
+  auto vtable = data.virtual_table_repository.GetByIndex(static_cast<runtime::ObjectDescriptor*>(obj)->vtable_index);
+
+  if (!vtable) {
+    return std::unexpected(vtable.error());
+  }
+
+  const std::string class_name = vtable.value()->GetName();
+  data.memory.machine_stack.emplace(obj);
+  auto copy_result = CallConstructor(data, "_" + class_name + "_" + class_name);
+
+  if (!copy_result) {
+    return std::unexpected(copy_result.error());
+  }
+
+  auto copy = TryExtractArgument<void*>(data, "CopyIfShared");
+
+  if (!copy) {
+    return std::unexpected(copy.error());
+  }
+
+  return copy.value();
+}
+
+// Literals are pooled Strings shared by every push. A local, static or field gets its own String over the same
+// characters, so a later copy assignment into that variable leaves the literal alone
+static std::expected<runtime::Variable, std::runtime_error> CopyIfLiteral(PassedExecutionData& data,
+                                                                          const runtime::Variable& value) {
+  if (!std::holds_alternative<void*>(value) || std::get<void*>(value) == nullptr ||
+      !runtime::BoxCache::IsImmortal(std::get<void*>(value))) {
+    return value;
+  }
+
+  void* obj = std::get<void*>(value);
+  auto string_index = data.virtual_table_repository.GetBuiltinTypes().GetIndex(runtime::BuiltinType::kString);
+
+  if (!string_index || static_cast<runtime::ObjectDescriptor*>(obj)->vtable_index != string_index.value()) {
+    return value;
+  }
+
+  auto copy = CopyIfShared(data, obj);
+
+  if (!copy) {
+    return std::unexpected(copy.error());
+  }
+
+  return copy.value();
+}
+
+std::expected<void, std::runtime_error> CollectGarbageBeforeRead(PassedExecutionData& data, std::istream& stream) {
+  if (stream.rdbuf() == nullptr || stream.rdbuf()->in_avail() != 0) {
+    return {};
+  }
+
+  return data.memory_manager.CollectGarbageWhileIdle(data, kBlockingReadIdleBudget);
+}
+
 std::expected<ExecutionResult, std::runtime_error> PushInt(PassedExecutionData& data, int64_t value) {
   data.memory.machine_stack.emplace(value);
 
@@ -105,59 +186,64 @@ std::expected<ExecutionResult, std::runtime_error> PushByte(PassedExecutionData&
 }
 
 std::expected<ExecutionResult, std::runtime_error> PushString(PassedExecutionData& data, const std::string& value) {
-  auto vtable_result = data.virtual_table_repository.GetByName("String");
+  auto string_obj_result = runtime::AllocateBuiltin<runtime::String>(data, runtime::BuiltinType::kString, value);
 
-  if (!vtable_result.has_value()) {
-    return std::unexpected(std::runtime_error("PushString: String vtable not found"));
+  if (!string_obj_result.has_value()) {
+    return std::unexpected(string_obj_result.error());
   }
 
-  const runtime::VirtualTable* string_vtable = vtable_result.value();
-  auto vtable_index_result = data.virtual_table_repository.GetIndexByName("String");
+  data.memory.machine_stack.emplace(string_obj_result.value());
 
-  if (!vtable_index_result.has_value()) {
-    return std::unexpected(vtable_index_result.error());
-  }
+  return ExecutionResult::kNormal;
+}
 
-  auto string_obj_result =
-      data.memory_manager.AllocateObject(*string_vtable, static_cast<uint32_t>(vtable_index_result.value()), data);
+std::expected<ExecutionResult, std::runtime_error> PushStringLiteral(PassedExecutionData& data,
+                                                                     const std::string& literal) {
+  auto string_obj = data.memory_manager.GetStringPool().Intern(literal, data.virtual_table_repository);
 
-  if (!string_obj_result.has_value()) {
-    return std::unexpected(string_obj_result.error());
+  if (!string_obj.has_value()) {
+    return std::unexpected(std::runtime_error("PushStringLiteral: String vtable not found"));
   }
 
-  void* string_obj = string_obj_result.value();
-  auto* string_data = runtime::GetDataPointer<std::string>(string_obj);
-  new (string_data) std::string(value);
+  data.memory.machine_stack.emplace(string_obj.value());
+
+  return ExecutionResult::kNormal;
+}
+
+std::expected<ExecutionResult, std::runtime_error> PushInternedString(PassedExecutionData& data, void* string_obj) {
   data.memory.machine_stack.emplace(string_obj);
 
   return ExecutionResult::kNormal;
 }
 
 std::expected<ExecutionResult, std::runtime_error> PushNull(PassedExecutionData& data) {
-  auto vtable_result = data.virtual_table_repository.GetByName("Nullable");
+  auto null_obj = data.memory_manager.GetBoxCache().GetNullBox(data.virtual_table_repository);
 
-  if (!vtable_result.has_value()) {
+  if (!null_obj.has_value()) {
     return std::unexpected(std::runtime_error("PushNull: Nullable vtable not found"));
   }
 
-  const runtime::VirtualTable* null_vtable = vtable_result.value();
-  auto vtable_index_result = data.virtual_table_repository.GetIndexByName("Nullable");
+  data.memory.machine_stack.emplace(null_obj.value());
+
+  return ExecutionResult::kNormal;
+}
 
-  if (!vtable_index_result.has_value()) {
-    return std::unexpected(vtable_index_result.error());
+std::expected<ExecutionResult, std::runtime_error> PushNullable(PassedExecutionData& data, void* value) {
+  if (value == nullptr) {
+    return PushNull(data);
   }
 
-  auto null_obj_result =
-      data.memory_manager.AllocateObject(*null_vtable, static_cast<uint32_t>(vtable_index_result.value()), data);
+  auto nullable_obj_result = runtime::AllocateBuiltin<void*>(data, runtime::BuiltinType::kNullable, nullptr);
 
-  if (!null_obj_result.has_value()) {
-    return std::unexpected(null_obj_result.error());
+  if (!nullable_obj_result.has_value()) {
+    return std::unexpected(nullable_obj_result.error());
   }
 
-  void* null_obj = null_obj_result.value();
-  auto* null_data = runtime::GetDataPointer<void*>(null_obj);
-  *null_data = nullptr;
-  data.memory.machine_stack.emplace(null_obj);
+  void* nullable_obj = nullable_obj_result.value();
+  auto* nullable_data = runtime::GetDataPointer<void*>(nullable_obj);
+  data.memory_manager.WriteBarrier(value);
+  *nullable_data = value;
+  data.memory.machine_stack.emplace(nullable_obj);
 
   return ExecutionResult::kNormal;
 }
@@ -239,7 +325,14 @@ std::expected<ExecutionResult, std::runtime_error> SetLocal(PassedExecutionData&
     data.memory.stack_frames.top().local_variables.resize(index + 1);
   }
 
-  data.memory.stack_frames.top().local_variables[index] = data.memory.machine_stack.top();
+  auto value = CopyIfLiteral(data, data.memory.machine_stack.top());
+
+  if (!value) {
+    return std::unexpected(value.error());
+  }
+
+  data.memory_manager.WriteBarrier(value.value());
+  data.memory.stack_frames.top().local_variables[index] = value.value();
   data.memory.machine_stack.pop();
 
   return ExecutionResult::kNormal;
@@ -256,7 +349,14 @@ std::expected<ExecutionResult, std::runtime_error> SetStatic(PassedExecutionData
     data.memory.global_variables.resize(index + 1);
   }
 
-  data.memory.global_variables[index] = data.memory.machine_stack.top();
+  auto value = CopyIfLiteral(data, data.memory.machine_stack.top());
+
+  if (!value) {
+    return std::unexpected(value.error());
+  }
+
+  data.memory_manager.WriteBarrier(value.value());
+  data.memory.global_variables[index] = value.value();
   data.memory.machine_stack.pop();
 
   return ExecutionResult::kNormal;
@@ -877,9 +977,11 @@ std::expected<ExecutionResult, std::runtime_error> StringConcat(PassedExecutionD
   }
 
   void* string_obj1 = arguments.value().first;
-  auto* str1_ptr = runtime::GetDataPointer<std::string>(string_obj1);
+  const auto* str1_ptr = runtime::GetDataPointer<const runtime::String>(string_obj1);
   void* string_obj2 = arguments.value().second;
-  auto* str2_ptr = runtime::GetDataPointer<std::string>(string_obj2);
+  const auto* str2_ptr = runtime::GetDataPointer<const runtime::String>(string_obj2);
+  // Allocating may move the operands, so the result is built before the new object exists
+  runtime::String result = str1_ptr->Concat(*str2_ptr);
   auto push_result = PushString(data, "");
   if (!push_result) {
     return std::unexpected(push_result.error());
@@ -890,10 +992,9 @@ std::expected<ExecutionResult, std::runtime_error> StringConcat(PassedExecutionD
     return std::unexpected(std::runtime_error("StringConcat: variable on the top of the stack has incorrect type"));
   }
 
-  auto res_ptr = runtime::GetDataPointer<std::string>(std::get<void*>(string_obj));
-
-  res_ptr->append(*str1_ptr);
-  res_ptr->append(*str2_ptr);
+  auto res_ptr = runtime::GetDataPointer<runtime::String>(std::get<void*>(string_obj));
+  *res_ptr = std::move(result);
+  data.memory_manager.ReportExternalMemory(std::get<void*>(string_obj), runtime::ExternalBytes(*res_ptr));
 
   return ExecutionResult::kNormal;
 }
@@ -905,9 +1006,9 @@ std::expected<ExecutionResult, std::runtime_error> StringLength(PassedExecutionD
   }
 
   void* string_obj1 = argument.value();
-  auto* str_ptr = runtime::GetDataPointer<std::string>(string_obj1);
+  const auto* str_ptr = runtime::GetDataPointer<const runtime::String>(string_obj1);
 
-  data.memory.machine_stack.emplace(static_cast<int64_t>(str_ptr->length()));
+  data.memory.machine_stack.emplace(static_cast<int64_t>(str_ptr->Size()));
 
   return ExecutionResult::kNormal;
 }
@@ -925,7 +1026,17 @@ std::expected<ExecutionResult, std::runtime_error> StringSubstring(PassedExecuti
   }
 
   void* string_obj1 = argument.value();
-  auto* str_ptr = runtime::GetDataPointer<std::string>(string_obj1);
+  const auto* str_ptr = runtime::GetDataPointer<const runtime::String>(string_obj1);
+  int64_t start = arguments.value().first;
+  int64_t length = arguments.value().second;
+
+  if (start < 0 || static_cast<size_t>(start) > str_ptr->Size()) {
+    return std::unexpected(std::runtime_error("StringSubstring: index out of range"));
+  }
+
+  // Shares the source buffer unless the slice is small enough to be worth copying out. A negative length wraps to a
+  // huge count and, as with std::string::substr, takes the rest of the string
+  runtime::String result = str_ptr->Substring(static_cast<size_t>(start), static_cast<size_t>(length));
   auto push_result = PushString(data, "");
   if (!push_result) {
     return std::unexpected(push_result.error());
@@ -933,11 +1044,12 @@ std::expected<ExecutionResult, std::runtime_error> StringSubstring(PassedExecuti
 
   auto string_obj = data.memory.machine_stack.top();
   if (!std::holds_alternative<void*>(string_obj)) {
-    return std::unexpected(std::runtime_error("StringConcat: variable on the top of the stack has incorrect type"));
+    return std::unexpected(std::runtime_error("StringSubstring: variable on the top of the stack has incorrect type"));
   }
 
-  auto res_ptr = runtime::GetDataPointer<std::string>(std::get<void*>(string_obj));
-  res_ptr->append(str_ptr->substr(arguments.value().first, arguments.value().second));
+  auto res_ptr = runtime::GetDataPointer<runtime::String>(std::get<void*>(string_obj));
+  *res_ptr = std::move(result);
+  data.memory_manager.ReportExternalMemory(std::get<void*>(string_obj), runtime::ExternalBytes(*res_ptr));
 
   return ExecutionResult::kNormal;
 }
@@ -949,11 +1061,11 @@ std::expected<ExecutionResult, std::runtime_error> StringCompare(PassedExecution
   }
 
   void* string_obj1 = arguments.value().first;
-  auto* str1_ptr = runtime::GetDataPointer<std::string>(string_obj1);
+  const auto* str1_ptr = runtime::GetDataPointer<const runtime::String>(string_obj1);
   void* string_obj2 = arguments.value().second;
-  auto* str2_ptr = runtime::GetDataPointer<std::string>(string_obj2);
+  const auto* str2_ptr = runtime::GetDataPointer<const runtime::String>(string_obj2);
 
-  auto res = std::strcmp(str1_ptr->c_str(), str2_ptr->c_str());
+  auto res = str1_ptr->View().compare(str2_ptr->View());
 
   data.memory.machine_stack.emplace(static_cast<int64_t>(res));
 
@@ -967,9 +1079,9 @@ std::expected<ExecutionResult, std::runtime_error> StringToInt(PassedExecutionDa
   }
 
   void* string_obj1 = argument.value();
-  auto* str_ptr = runtime::GetDataPointer<std::string>(string_obj1);
+  std::string str = runtime::GetDataPointer<const runtime::String>(string_obj1)->ToStdString();
 
-  long long res = std::stoll(*str_ptr);
+  long long res = std::stoll(str);
 
   data.memory.machine_stack.emplace(static_cast<int64_t>(res));
 
@@ -983,9 +1095,9 @@ std::expected<ExecutionResult, std::runtime_error> StringToFloat(PassedExecution
   }
 
   void* string_obj1 = argument.value();
-  auto* str_ptr = runtime::GetDataPointer<std::string>(string_obj1);
+  std::string str = runtime::GetDataPointer<const runtime::String>(string_obj1)->ToStdString();
 
-  auto res = std::stod(*str_ptr);
+  auto res = std::stod(str);
 
   data.memory.machine_stack.emplace(static_cast<double>(res));
 
@@ -1099,6 +1211,10 @@ std::expected<ExecutionResult, std::runtime_error> CallIndirect(PassedExecutionD
 }
 
 std::expected<ExecutionResult, std::runtime_error> CallVirtual(PassedExecutionData& data, const std::string& method) {
+  return CallVirtualBySlot(data, runtime::MethodSlots::GetOrAssign(method));
+}
+
+std::expected<ExecutionResult, std::runtime_error> CallVirtualBySlot(PassedExecutionData& data, size_t slot) {
   auto argument = TryExtractArgument<void*>(data, "CallVirtual");
   if (!argument) {
     return std::unexpected(argument.error());
@@ -1111,14 +1227,7 @@ std::expected<ExecutionResult, std::runtime_error> CallVirtual(PassedExecutionDa
     return std::unexpected(vtable.error());
   }
 
-  auto function_id = vtable.value()->GetRealFunctionId(method);
-
-  if (!function_id) {
-    return std::unexpected(function_id.error());
-  }
-
-  const runtime::FunctionId const_function_id = std::move(function_id.value());
-  auto function = data.function_repository.GetById(const_function_id);
+  auto function = vtable.value()->GetFunctionBySlot(slot, data.function_repository);
 
   if (!function) {
     return std::unexpected(function.error());
@@ -1177,8 +1286,16 @@ std::expected<ExecutionResult, std::runtime_error> SetField(PassedExecutionData&
     return std::unexpected(std::runtime_error("SetField: not enough arguments on the stack"));
   }
 
-  runtime::Variable argument2 = data.memory.machine_stack.top();
+  // Both operands stay on the stack while a literal is copied, so a collection triggered by the copy keeps them
+  const runtime::Variable stored = data.memory.machine_stack.top();
+  data.memory.machine_stack.emplace(argument1.value());
+  auto argument2 = CopyIfLiteral(data, stored);
   data.memory.machine_stack.pop();
+  data.memory.machine_stack.pop();
+
+  if (!argument2) {
+    return std::unexpected(argument2.error());
+  }
 
   auto vtable = data.virtual_table_repository.GetByIndex(
       reinterpret_cast<runtime::ObjectDescriptor*>(argument1.value())->vtable_index);
@@ -1187,7 +1304,8 @@ std::expected<ExecutionResult, std::runtime_error> SetField(PassedExecutionData&
     return std::unexpected(vtable.error());
   }
 
-  auto result = vtable.value()->SetVariableByIndex(argument1.value(), number, argument2);
+  data.memory_manager.WriteBarrier(argument2.value());
+  auto result = vtable.value()->SetVariableByIndex(argument1.value(), number, argument2.value());
 
   if (!result) {
     return std::unexpected(result.error());
@@ -1267,6 +1385,16 @@ std::expected<ExecutionResult, std::runtime_error> Unwrap(PassedExecutionData& d
     return std::unexpected(std::runtime_error("Unwrap: cannot unwrap null"));
   }
 
+  if (std::holds_alternative<void*>(wrapped)) {
+    auto unwrapped = CopyIfShared(data, std::get<void*>(wrapped));
+
+    if (!unwrapped) {
+      return std::unexpected(unwrapped.error());
+    }
+
+    wrapped = unwrapped.value();
+  }
+
   data.memory.machine_stack.emplace(wrapped);
 
   return ExecutionResult::kNormal;
@@ -1355,14 +1483,8 @@ std::expected<ExecutionResult, std::runtime_error> SafeCall(PassedExecutionData&
       return std::unexpected(vtable.error());
     }
 
-    auto function_id = vtable.value()->GetRealFunctionId(method);
-
-    if (!function_id) {
-      return std::unexpected(function_id.error());
-    }
-
-    const runtime::FunctionId const_function_id = std::move(function_id.value());
-    auto vtable_function = data.function_repository.GetById(const_function_id);
+    auto vtable_function =
+        vtable.value()->GetFunctionBySlot(runtime::MethodSlots::GetOrAssign(method), data.function_repository);
 
     if (!vtable_function) {
       return std::unexpected(vtable_function.error());
@@ -1384,72 +1506,55 @@ std::expected<ExecutionResult, std::runtime_error> SafeCall(PassedExecutionData&
 
   if (std::holds_alternative<void*>(return_value)) {
     data.memory.machine_stack.pop();
-    void* result_obj = std::get<void*>(return_value);
-    auto push_nullable_result = PushNull(data);
-
-    if (!push_nullable_result) {
-      return std::unexpected(push_nullable_result.error());
-    }
-
-    runtime::Variable nullable_result_obj = data.memory.machine_stack.top();
-
-    if (!std::holds_alternative<void*>(nullable_result_obj)) {
-      return std::unexpected(std::runtime_error("SafeCall: nullable result object has incorrect type"));
-    }
 
-    void* nullable_result = std::get<void*>(nullable_result_obj);
-    auto* nullable_result_data = runtime::GetDataPointer<void*>(nullable_result);
-    *nullable_result_data = result_obj;
-
-    return ExecutionResult::kNormal;
+    return PushNullable(data, std::get<void*>(return_value));
   }
 
-  std::string constructor_name;
-  runtime::Variable fundamental_value = return_value;
+  // Unwrap and NullCoalesce copy a shared box before handing it to the program, so the Nullable can hold one
+  auto cached_box = data.memory_manager.GetBoxCache().GetBox(return_value, data.virtual_table_repository);
 
-  if (std::holds_alternative<int64_t>(fundamental_value)) {
-    constructor_name = "_Int_int";
-  } else if (std::holds_alternative<double>(fundamental_value)) {
-    constructor_name = "_Float_float";
-  } else if (std::holds_alternative<bool>(fundamental_value)) {
-    constructor_name = "_Bool_bool";
-  } else if (std::holds_alternative<char>(fundamental_value)) {
-    constructor_name = "_Char_char";
-  } else if (std::holds_alternative<uint8_t>(fundamental_value)) {
-    constructor_name = "_Byte_byte";
-  } else {
-    return std::unexpected(std::runtime_error("SafeCall: unknown return type"));
+  if (!cached_box) {
+    return std::unexpected(cached_box.error());
   }
 
-  auto constructor_result = CallConstructor(data, constructor_name);
+  void* boxed_obj = cached_box.value();
 
-  if (!constructor_result) {
-    return std::unexpected(constructor_result.error());
-  }
-
-  auto constructed_obj = TryExtractArgument<void*>(data, "SafeCall");
+  if (boxed_obj != nullptr) {
+    data.memory.machine_stack.pop();
+  } else {
+    std::string constructor_name;
+    runtime::Variable fundamental_value = return_value;
+
+    if (std::holds_alternative<int64_t>(fundamental_value)) {
+      constructor_name = "_Int_int";
+    } else if (std::holds_alternative<double>(fundamental_value)) {
+      constructor_name = "_Float_float";
+    } else if (std::holds_alternative<bool>(fundamental_value)) {
+      constructor_name = "_Bool_bool";
+    } else if (std::holds_alternative<char>(fundamental_value)) {
+      constructor_name = "_Char_char";
+    } else if (std::holds_alternative<uint8_t>(fundamental_value)) {
+      constructor_name = "_Byte_byte";
+    } else {
+      return std::unexpected(std::runtime_error("SafeCall: unknown return type"));
+    }
 
-  if (!constructed_obj) {
-    return std::unexpected(std::runtime_error("SafeCall: failed to extract constructed object"));
-  }
+    auto constructor_result = CallConstructor(data, constructor_name);
 
-  auto push_nullable_result = PushNull(data);
+    if (!constructor_result) {
+      return std::unexpected(constructor_result.error());
+    }
 
-  if (!push_nullable_result) {
-    return std::unexpected(push_nullable_result.error());
-  }
+    auto constructed_obj = TryExtractArgument<void*>(data, "SafeCall");
 
-  runtime::Variable nullable_result_obj = data.memory.machine_stack.top();
+    if (!constructed_obj) {
+      return std::unexpected(std::runtime_error("SafeCall: failed to extract constructed object"));
+    }
 
-  if (!std::holds_alternative<void*>(nullable_result_obj)) {
-    return std::unexpected(std::runtime_error("SafeCall: nullable result object has incorrect type"));
+    boxed_obj = constructed_obj.value();
   }
 
-  void* nullable_result = std::get<void*>(nullable_result_obj);
-  auto* nullable_result_data = runtime::GetDataPointer<void*>(nullable_result);
-  *nullable_result_data = constructed_obj.value();
-
-  return ExecutionResult::kNormal;
+  return PushNullable(data, boxed_obj);
 }
 
 std::expected<ExecutionResult, std::runtime_error> NullCoalesce(PassedExecutionData& data) {
@@ -1462,8 +1567,14 @@ std::expected<ExecutionResult, std::runtime_error> NullCoalesce(PassedExecutionD
   auto* tested_result_data = runtime::GetDataPointer<void*>(tested_result.value());
 
   if (*tested_result_data != nullptr) {
+    auto value = CopyIfShared(data, *tested_result_data);
+
+    if (!value) {
+      return std::unexpected(value.error());
+    }
+
     data.memory.machine_stack.pop();
-    data.memory.machine_stack.emplace(*tested_result_data);
+    data.memory.machine_stack.emplace(value.value());
   }
 
   return ExecutionResult::kNormal;
@@ -1484,6 +1595,83 @@ std::expected<ExecutionResult, std::runtime_error> IsNull(PassedExecutionData& d
   return ExecutionResult::kNormal;
 }
 
+template<typename T>
+std::expected<ExecutionResult, std::runtime_error> UnwrapFreshValue(PassedExecutionData& data,
+                                                                    const std::string& function_name) {
+  auto argument = TryExtractArgument<T>(data, function_name);
+
+  if (!argument) {
+    return std::unexpected(argument.error());
+  }
+
+  data.memory.machine_stack.emplace(argument.value());
+
+  return ExecutionResult::kNormal;
+}
+
+std::expected<ExecutionResult, std::runtime_error> UnwrapFreshInt(PassedExecutionData& data) {
+  return UnwrapFreshValue<int64_t>(data, "UnwrapFreshInt");
+}
+
+std::expected<ExecutionResult, std::runtime_error> UnwrapFreshFloat(PassedExecutionData& data) {
+  return UnwrapFreshValue<double>(data, "UnwrapFreshFloat");
+}
+
+std::expected<ExecutionResult, std::runtime_error> UnwrapFreshChar(PassedExecutionData& data) {
+  return UnwrapFreshValue<char>(data, "UnwrapFreshChar");
+}
+
+std::expected<ExecutionResult, std::runtime_error> UnwrapFreshByte(PassedExecutionData& data) {
+  return UnwrapFreshValue<uint8_t>(data, "UnwrapFreshByte");
+}
+
+std::expected<ExecutionResult, std::runtime_error> UnwrapFreshBool(PassedExecutionData& data) {
+  return UnwrapFreshValue<bool>(data, "UnwrapFreshBool");
+}
+
+std::expected<ExecutionResult, std::runtime_error> UnwrapFreshNullable(PassedExecutionData& data) {
+  auto argument = TryExtractArgument<void*>(data, "UnwrapFreshNullable");
+
+  if (!argument) {
+    return std::unexpected(argument.error());
+  }
+
+  if (argument.value() == nullptr) {
+    return std::unexpected(std::runtime_error("Unwrap: cannot unwrap null"));
+  }
+
+  data.memory.machine_stack.emplace(argument.value());
+
+  return ExecutionResult::kNormal;
+}
+
+std::expected<ExecutionResult, std::runtime_error> IsNullFreshNullable(PassedExecutionData& data) {
+  auto argument = TryExtractArgument<void*>(data, "IsNullFreshNullable");
+
+  if (!argument) {
+    return std::unexpected(argument.error());
+  }
+
+  data.memory.machine_stack.emplace(argument.value() == nullptr);
+
+  return ExecutionResult::kNormal;
+}
+
+std::expected<ExecutionResult, std::runtime_error> NullCoalesceFreshNullable(PassedExecutionData& data) {
+  auto argument = TryExtractArgument<void*>(data, "NullCoalesceFreshNullable");
+
+  if (!argument) {
+    return std::unexpected(argument.error());
+  }
+
+  if (argument.value() != nullptr) {
+    data.memory.machine_stack.pop();
+    data.memory.machine_stack.emplace(argument.value());
+  }
+
+  return ExecutionResult::kNormal;
+}
+
 std::expected<ExecutionResult, std::runtime_error> Print(PassedExecutionData& data) {
   auto argument = TryExtractArgument<void*>(data, "Print");
   if (!argument) {
@@ -1491,9 +1679,9 @@ std::expected<ExecutionResult, std::runtime_error> Print(PassedExecutionData& da
   }
 
   void* string_obj1 = argument.value();
-  auto* str_ptr = runtime::GetDataPointer<std::string>(string_obj1);
+  const auto* str_ptr = runtime::GetDataPointer<const runtime::String>(string_obj1);
 
-  data.output_stream << *str_ptr;
+  data.output_stream << str_ptr->View();
 
   return ExecutionResult::kNormal;
 }
@@ -1505,14 +1693,20 @@ std::expected<ExecutionResult, std::runtime_error> PrintLine(PassedExecutionData
   }
 
   void* string_obj1 = argument.value();
-  auto* str_ptr = runtime::GetDataPointer<std::string>(string_obj1);
+  const auto* str_ptr = runtime::GetDataPointer<const runtime::String>(string_obj1);
 
-  data.output_stream << *str_ptr << '\n';
+  data.output_stream << str_ptr->View() << '\n';
 
   return ExecutionResult::kNormal;
 }
 
 std::expected<ExecutionResult, std::runtime_error> ReadLine(PassedExecutionData& data) {
+  std::expected<void, std::runtime_error> gc_res = CollectGarbageBeforeRead(data, data.input_stream);
+
+  if (!gc_res.has_value()) {
+    return std::unexpected(gc_res.error());
+  }
+
   std::string res;
 
   std::getline(data.input_stream, res);
@@ -1521,6 +1715,12 @@ std::expected<ExecutionResult, std::runtime_error> ReadLine(PassedExecutionData&
 }
 
 std::expected<ExecutionResult, std::runtime_error> ReadChar(PassedExecutionData& data) {
+  std::expected<void, std::runtime_error> gc_res = CollectGarbageBeforeRead(data, data.input_stream);
+
+  if (!gc_res.has_value()) {
+    return std::unexpected(gc_res.error());
+  }
+
   char c = '\0';
 
   data.input_stream >> c;
@@ -1529,6 +1729,12 @@ std::expected<ExecutionResult, std::runtime_error> ReadChar(PassedExecutionData&
 }
 
 std::expected<ExecutionResult, std::runtime_error> ReadInt(PassedExecutionData& data) {
+  std::expected<void, std::runtime_error> gc_res = CollectGarbageBeforeRead(data, data.input_stream);
+
+  if (!gc_res.has_value()) {
+    return std::unexpected(gc_res.error());
+  }
+
   int64_t i = 0;
 
   data.input_stream >> i;
@@ -1537,6 +1743,12 @@ std::expected<ExecutionResult, std::runtime_error> ReadInt(PassedExecutionData&
 }
 
 std::expected<ExecutionResult, std::runtime_error> ReadFloat(PassedExecutionData& data) {
+  std::expected<void, std::runtime_error> gc_res = CollectGarbageBeforeRead(data, data.input_stream);
+
+  if (!gc_res.has_value()) {
+    return std::unexpected(gc_res.error());
+  }
+
   double d = 0.0;
 
   data.input_stream >> d;
@@ -1590,7 +1802,7 @@ std::expected<ExecutionResult, std::runtime_error> FormatDateTime(PassedExecutio
   auto timestamp_var = arguments.value().first;
 
   void* string_obj1 = arguments.value().second;
-  auto* format_str_ptr = runtime::GetDataPointer<std::string>(string_obj1);
+  std::string format_str = runtime::GetDataPointer<const runtime::String>(string_obj1)->ToStdString();
 
   try {
     auto time_point = std::chrono::system_clock::from_time_t(timestamp_var);
@@ -1599,33 +1811,17 @@ std::expected<ExecutionResult, std::runtime_error> FormatDateTime(PassedExecutio
     std::tm tm = *std::localtime(&time_t_val);
 
     std::stringstream ss;
-    ss << std::put_time(&tm, format_str_ptr->c_str());
+    ss << std::put_time(&tm, format_str.c_str());
     std::string result_str = ss.str();
 
-    auto vtable_result = data.virtual_table_repository.GetByName("String");
-    if (!vtable_result.has_value()) {
-      return std::unexpected(std::runtime_error("FormatDateTime: String vtable not found"));
-    }
-
-    const runtime::VirtualTable* string_vtable = vtable_result.value();
-    auto vtable_index_result = data.virtual_table_repository.GetIndexByName("String");
-    if (!vtable_index_result.has_value()) {
-      return std::unexpected(vtable_index_result.error());
-    }
-
     auto string_obj_result =
-        data.memory_manager.AllocateObject(*string_vtable, static_cast<uint32_t>(vtable_index_result.value()), data);
+        runtime::AllocateBuiltin<runtime::String>(data, runtime::BuiltinType::kString, std::move(result_str));
 
     if (!string_obj_result.has_value()) {
       return std::unexpected(string_obj_result.error());
     }
 
-    void* string_obj = string_obj_result.value();
-    auto* string_data = runtime::GetDataPointer<std::string>(string_obj);
-
-    new (string_data) std::string(std::move(result_str));
-
-    data.memory.machine_stack.emplace(string_obj);
+    data.memory.machine_stack.emplace(string_obj_result.value());
     return ExecutionResult::kNormal;
   } catch (const std::exception& e) {
     return std::unexpected(std::runtime_error(std::string("FormatDateTime: ") + e.what()));
@@ -1642,13 +1838,13 @@ std::expected<ExecutionResult, std::runtime_error> ParseDateTime(PassedExecution
   auto format_var = arguments.value().first;
   auto date_str_var = arguments.value().second;
 
-  auto format_str_ptr = runtime::GetDataPointer<std::string>(format_var);
-  auto date_str_ptr = runtime::GetDataPointer<std::string>(date_str_var);
+  std::string format_str = runtime::GetDataPointer<const runtime::String>(format_var)->ToStdString();
+  std::string date_str = runtime::GetDataPointer<const runtime::String>(date_str_var)->ToStdString();
 
   try {
     std::tm tm = {};
-    std::stringstream ss(date_str_ptr->c_str());
-    ss >> std::get_time(&tm, format_str_ptr->c_str());
+    std::stringstream ss(date_str.c_str());
+    ss >> std::get_time(&tm, format_str.c_str());
 
     if (ss.fail()) {
       return std::unexpected(std::runtime_error("ParseDateTime: failed to parse date string"));
@@ -1658,29 +1854,14 @@ std::expected<ExecutionResult, std::runtime_error> ParseDateTime(PassedExecution
     auto time_point = std::chrono::system_clock::from_time_t(time_t_val);
     auto timestamp = std::chrono::duration_cast<std::chrono::seconds>(time_point.time_since_epoch()).count();
 
-    auto vtable_result = data.virtual_table_repository.GetByName("Int");
-    if (!vtable_result.has_value()) {
-      return std::unexpected(std::runtime_error("ParseDateTime: Int vtable not found"));
-    }
-
-    const runtime::VirtualTable* int_vtable = vtable_result.value();
-    auto vtable_index_result = data.virtual_table_repository.GetIndexByName("Int");
-    if (!vtable_index_result.has_value()) {
-      return std::unexpected(vtable_index_result.error());
-    }
-
     auto int_obj_result =
-        data.memory_manager.AllocateObject(*int_vtable, static_cast<uint32_t>(vtable_index_result.value()), data);
+        runtime::AllocateBuiltin<int64_t>(data, runtime::BuiltinType::kInt, static_cast<int64_t>(timestamp));
 
     if (!int_obj_result.has_value()) {
       return std::unexpected(int_obj_result.error());
     }
 
-    void* int_obj = int_obj_result.value();
-    auto* int_data = runtime::GetDataPointer<int64_t>(int_obj);
-    *int_data = static_cast<int64_t>(timestamp);
-
-    data.memory.machine_stack.emplace(int_obj);
+    data.memory.machine_stack.emplace(int_obj_result.value());
     return ExecutionResult::kNormal;
   } catch (const std::exception& e) {
     return std::unexpected(std::runtime_error(std::string("ParseDateTime: ") + e.what()));
@@ -1693,10 +1874,10 @@ std::expected<ExecutionResult, std::runtime_error> FileExists(PassedExecutionDat
     return std::unexpected(filename_ptr.error());
   }
 
-  auto filename = runtime::GetDataPointer<std::string>(filename_ptr.value());
+  std::string filename = runtime::GetDataPointer<const runtime::String>(filename_ptr.value())->ToStdString();
 
   try {
-    bool exists = std::filesystem::exists(*filename);
+    bool exists = std::filesystem::exists(filename);
     data.memory.machine_stack.emplace(exists);
     return ExecutionResult::kNormal;
   } catch (const std::exception& e) {
@@ -1710,10 +1891,10 @@ std::expected<ExecutionResult, std::runtime_error> DirectoryExists(PassedExecuti
     return std::unexpected(dirname_ptr.error());
   }
 
-  auto dirname = runtime::GetDataPointer<std::string>(dirname_ptr.value());
+  std::string dirname = runtime::GetDataPointer<const runtime::String>(dirname_ptr.value())->ToStdString();
 
   try {
-    bool exists = std::filesystem::is_directory(*dirname);
+    bool exists = std::filesystem::is_directory(dirname);
     data.memory.machine_stack.emplace(exists);
     return ExecutionResult::kNormal;
   } catch (const std::exception& e) {
@@ -1727,10 +1908,10 @@ std::expected<ExecutionResult, std::runtime_error> CreateDir(PassedExecutionData
     return std::unexpected(dirname_ptr.error());
   }
 
-  auto dirname = runtime::GetDataPointer<std::string>(dirname_ptr.value());
+  std::string dirname = runtime::GetDataPointer<const runtime::String>(dirname_ptr.value())->ToStdString();
 
   try {
-    bool created = std::filesystem::create_directory(*dirname);
+    bool created = std::filesystem::create_directory(dirname);
     data.memory.machine_stack.emplace(created);
     return ExecutionResult::kNormal;
   } catch (const std::exception& e) {
@@ -1744,10 +1925,10 @@ std::expected<ExecutionResult, std::runtime_error> DeleteFileByName(PassedExecut
     return std::unexpected(filename_ptr.error());
   }
 
-  auto filename = runtime::GetDataPointer<std::string>(filename_ptr.value());
+  std::string filename = runtime::GetDataPointer<const runtime::String>(filename_ptr.value())->ToStdString();
 
   try {
-    bool deleted = std::filesystem::remove(*filename);
+    bool deleted = std::filesystem::remove(filename);
     data.memory.machine_stack.emplace(deleted);
     return ExecutionResult::kNormal;
   } catch (const std::exception& e) {
@@ -1761,10 +1942,10 @@ std::expected<ExecutionResult, std::runtime_error> DeleteDir(PassedExecutionData
     return std::unexpected(dirname_ptr.error());
   }
 
-  auto dirname = runtime::GetDataPointer<std::string>(dirname_ptr.value());
+  std::string dirname = runtime::GetDataPointer<const runtime::String>(dirname_ptr.value())->ToStdString();
 
   try {
-    bool deleted = std::filesystem::remove_all(*dirname) > 0;
+    bool deleted = std::filesystem::remove_all(dirname) > 0;
     data.memory.machine_stack.emplace(deleted);
     return ExecutionResult::kNormal;
   } catch (const std::exception& e) {
@@ -1779,11 +1960,11 @@ std::expected<ExecutionResult, std::runtime_error> MoveFileByName(PassedExecutio
     return std::unexpected(arguments.error());
   }
 
-  auto src_ptr = runtime::GetDataPointer<std::string>(arguments.value().first);
-  auto dest_ptr = runtime::GetDataPointer<std::string>(arguments.value().second);
+  std::string src = runtime::GetDataPointer<const runtime::String>(arguments.value().first)->ToStdString();
+  std::string dest = runtime::GetDataPointer<const runtime::String>(arguments.value().second)->ToStdString();
 
   try {
-    std::filesystem::rename(*src_ptr, *dest_ptr);
+    std::filesystem::rename(src, dest);
     data.memory.machine_stack.emplace(true);
     return ExecutionResult::kNormal;
   } catch (const std::exception& e) {
@@ -1799,11 +1980,11 @@ std::expected<ExecutionResult, std::runtime_error> CopyFileByName(PassedExecutio
     return std::unexpected(arguments.error());
   }
 
-  auto src_ptr = runtime::GetDataPointer<std::string>(arguments.value().first);
-  auto dest_ptr = runtime::GetDataPointer<std::string>(arguments.value().second);
+  std::string src = runtime::GetDataPointer<const runtime::String>(arguments.value().first)->ToStdString();
+  std::string dest = runtime::GetDataPointer<const runtime::String>(arguments.value().second)->ToStdString();
 
   try {
-    std::filesystem::copy(*src_ptr, *dest_ptr);
+    std::filesystem::copy(src, dest);
     data.memory.machine_stack.emplace(true);
     return ExecutionResult::kNormal;
   } catch (const std::exception& e) {
@@ -1818,58 +1999,31 @@ std::expected<ExecutionResult, std::runtime_error> ListDir(PassedExecutionData&
     return std::unexpected(dirname_ptr.error());
   }
 
-  auto dirname = runtime::GetDataPointer<std::string>(dirname_ptr.value());
+  std::string dirname = runtime::GetDataPointer<const runtime::String>(dirname_ptr.value())->ToStdString();
 
   try {
-    auto vtable_result = data.virtual_table_repository.GetByName("StringArray");
-    if (!vtable_result.has_value()) {
-      return std::unexpected(std::runtime_error("ListDirectory: StringArray vtable not found"));
-    }
-
-    const runtime::VirtualTable* string_array_vtable = vtable_result.value();
-    auto vtable_index_result = data.virtual_table_repository.GetIndexByName("StringArray");
-    if (!vtable_index_result.has_value()) {
-      return std::unexpected(vtable_index_result.error());
-    }
-
-    auto string_array_obj_result = data.memory_manager.AllocateObject(
-        *string_array_vtable, static_cast<uint32_t>(vtable_index_result.value()), data);
+    auto string_array_obj_result =
+        runtime::AllocateBuiltin<std::vector<void*>>(data, runtime::BuiltinType::kStringArray);
     if (!string_array_obj_result.has_value()) {
       return std::unexpected(string_array_obj_result.error());
     }
 
     void* string_array_obj = string_array_obj_result.value();
     auto* vec_data = runtime::GetDataPointer<std::vector<void*>>(string_array_obj);
-    new (vec_data) std::vector<void*>();
-
-    for (const auto& entry : std::filesystem::directory_iterator(*dirname)) {
-      auto path_str = entry.path().string();
-
-      auto string_vtable_result = data.virtual_table_repository.GetByName("String");
-      if (!string_vtable_result.has_value()) {
-        return std::unexpected(std::runtime_error("ListDirectory: String vtable not found"));
-      }
-
-      const runtime::VirtualTable* string_vtable = string_vtable_result.value();
-      auto string_vtable_index_result = data.virtual_table_repository.GetIndexByName("String");
-      if (!string_vtable_index_result.has_value()) {
-        return std::unexpected(string_vtable_index_result.error());
-      }
 
-      auto string_obj_result = data.memory_manager.AllocateObject(
-          *string_vtable, static_cast<uint32_t>(string_vtable_index_result.value()), data);
+    for (const auto& entry : std::filesystem::directory_iterator(dirname)) {
+      auto string_obj_result =
+          runtime::AllocateBuiltin<runtime::String>(data, runtime::BuiltinType::kString, entry.path().string());
 
       if (!string_obj_result.has_value()) {
         return std::unexpected(string_obj_result.error());
       }
 
-      void* string_obj = string_obj_result.value();
-      auto* string_data = runtime::GetDataPointer<std::string>(string_obj);
-      new (string_data) std::string(path_str);
-
-      vec_data->push_back(string_obj);
+      vec_data->push_back(string_obj_result.value());
     }
 
+    data.memory_manager.ReportExternalMemory(string_array_obj, runtime::ExternalBytes(*vec_data));
+
     data.memory.machine_stack.emplace(string_array_obj);
     return ExecutionResult::kNormal;
   } catch (const std::exception& e) {
@@ -1892,10 +2046,10 @@ std::expected<ExecutionResult, std::runtime_error> ChangeDir(PassedExecutionData
     return std::unexpected(dirname_ptr.error());
   }
 
-  auto dirname = runtime::GetDataPointer<std::string>(dirname_ptr.value());
+  std::string dirname = runtime::GetDataPointer<const runtime::String>(dirname_ptr.value())->ToStdString();
 
   try {
-    std::filesystem::current_path(*dirname);
+    std::filesystem::current_path(dirname);
     data.memory.machine_stack.emplace(true);
     return ExecutionResult::kNormal;
   } catch (const std::exception& e) {
@@ -1911,8 +2065,7 @@ std::expected<ExecutionResult, std::runtime_error> SleepMs(PassedExecutionData&
   }
 
   auto ms = ms_arg.value();
-  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
-  return ExecutionResult::kNormal;
+  return SleepWhileCollecting(data, std::chrono::milliseconds(ms));
 }
 
 std::expected<ExecutionResult, std::runtime_error> SleepNs(PassedExecutionData& data) {
@@ -1922,8 +2075,7 @@ std::expected<ExecutionResult, std::runtime_error> SleepNs(PassedExecutionData&
   }
 
   auto ns = ns_arg.value();
-  std::this_thread::sleep_for(std::chrono::nanoseconds(ns));
-  return ExecutionResult::kNormal;
+  return SleepWhileCollecting(data, std::chrono::nanoseconds(ns));
 }
 
 std::expected<ExecutionResult, std::runtime_error> Exit(PassedExecutionData& data) {
@@ -1954,39 +2106,24 @@ std::expected<ExecutionResult, std::runtime_error> GetEnvironmentVar(PassedExecu
     return std::unexpected(name_ptr.error());
   }
 
-  auto name = runtime::GetDataPointer<std::string>(name_ptr.value());
+  std::string name = runtime::GetDataPointer<const runtime::String>(name_ptr.value())->ToStdString();
 
-  const char* value = std::getenv(name->c_str()); // NOLINT
+  const char* value = std::getenv(name.c_str()); // NOLINT
   if (!value) {
     return PushNull(data);
-  } else {
-    auto null_result = PushNull(data);
-    if (!null_result) {
-      return std::unexpected(null_result.error());
-    }
-
-    auto string_result = PushString(data, std::string(value));
-    if (!string_result) {
-      return std::unexpected(string_result.error());
-    }
-
-    auto string_ptr = TryExtractArgument<void*>(data, "GetEnvironmentVariable");
-    if (!string_ptr) {
-      return std::unexpected(string_ptr.error());
-    }
-
-    runtime::Variable nullable_obj = data.memory.machine_stack.top();
-    if (!std::holds_alternative<void*>(nullable_obj)) {
-      return std::unexpected(
-          std::runtime_error("GetEnvironmentVariable: variable on the top of the stack has incorrect type"));
-    }
+  }
 
-    void* nullable_ptr = std::get<void*>(nullable_obj);
-    auto* nullable_value_ptr = runtime::GetDataPointer<void*>(nullable_ptr);
-    *nullable_value_ptr = string_ptr.value();
+  auto string_result = PushString(data, std::string(value));
+  if (!string_result) {
+    return std::unexpected(string_result.error());
+  }
 
-    return ExecutionResult::kNormal;
+  auto string_ptr = TryExtractArgument<void*>(data, "GetEnvironmentVariable");
+  if (!string_ptr) {
+    return std::unexpected(string_ptr.error());
   }
+
+  return PushNullable(data, string_ptr.value());
 }
 
 std::expected<ExecutionResult, std::runtime_error> SetEnvironmentVar(PassedExecutionData& data) {
@@ -1996,13 +2133,13 @@ std::expected<ExecutionResult, std::runtime_error> SetEnvironmentVar(PassedExecu
     return std::unexpected(arguments.error());
   }
 
-  auto name_ptr = runtime::GetDataPointer<std::string>(arguments.value().first);
-  auto value_ptr = runtime::GetDataPointer<std::string>(arguments.value().second);
+  std::string name = runtime::GetDataPointer<const runtime::String>(arguments.value().first)->ToStdString();
+  std::string value = runtime::GetDataPointer<const runtime::String>(arguments.value().second)->ToStdString();
 
 #ifdef _WIN32
-  bool success = SetEnvironmentVariable(name_ptr->c_str(), value_ptr->c_str()) != 0;
+  bool success = SetEnvironmentVariable(name.c_str(), value.c_str()) != 0;
 #else
-  bool success = setenv(name_ptr->c_str(), value_ptr->c_str(), 1) == 0;
+  bool success = setenv(name.c_str(), value.c_str(), 1) == 0;
 #endif
 
   data.memory.machine_stack.emplace(success);
@@ -2229,20 +2366,32 @@ std::expected<ExecutionResult, std::runtime_error> TypeOf(PassedExecutionData& d
 }
 
 std::expected<ExecutionResult, std::runtime_error> IsType(PassedExecutionData& data, const std::string& type) {
+  return IsTypeById(data, runtime::TypeIds::GetOrAssign(type));
+}
+
+std::expected<ExecutionResult, std::runtime_error> IsTypeById(PassedExecutionData& data, size_t type_id) {
+  static const size_t kIntTypeId = runtime::TypeIds::GetOrAssign("int");
+  static const size_t kFloatTypeId = runtime::TypeIds::GetOrAssign("float");
+  static const size_t kBoolTypeId = runtime::TypeIds::GetOrAssign("bool");
+  static const size_t kCharTypeId = runtime::TypeIds::GetOrAssign("char");
+  static const size_t kByteTypeId = runtime::TypeIds::GetOrAssign("byte");
+  static const size_t kNullableTypeId = runtime::TypeIds::GetOrAssign("Nullable");
+  static const size_t kNullTypeId = runtime::TypeIds::GetOrAssign("Null");
+
   bool is_type = false;
   runtime::Variable var = data.memory.machine_stack.top();
   data.memory.machine_stack.pop();
 
   if (std::holds_alternative<int64_t>(var)) {
-    is_type = type == "int";
+    is_type = type_id == kIntTypeId;
   } else if (std::holds_alternative<double>(var)) {
-    is_type = type == "float";
+    is_type = type_id == kFloatTypeId;
   } else if (std::holds_alternative<bool>(var)) {
-    is_type = type == "bool";
+    is_type = type_id == kBoolTypeId;
   } else if (std::holds_alternative<char>(var)) {
-    is_type = type == "char";
+    is_type = type_id == kCharTypeId;
   } else if (std::holds_alternative<uint8_t>(var)) {
-    is_type = type == "byte";
+    is_type = type_id == kByteTypeId;
   } else if (std::holds_alternative<void*>(var)) {
     auto vtable = data.virtual_table_repository.GetByIndex(
         static_cast<ovum::vm::runtime::ObjectDescriptor*>(std::get<void*>(var))->vtable_index);
@@ -2251,14 +2400,14 @@ std::expected<ExecutionResult, std::runtime_error> IsType(PassedExecutionData& d
       return std::unexpected(vtable.error());
     }
 
-    if (vtable.value()->GetName() != "Nullable") {
-      is_type = vtable.value()->GetName() == type;
+    if (vtable.value()->GetTypeId() != kNullableTypeId) {
+      is_type = vtable.value()->GetTypeId() == type_id;
     } else {
       void* wrapped_var_ptr = std::get<void*>(var);
       auto* wrapped_var_data_ptr = runtime::GetDataPointer<void*>(wrapped_var_ptr);
 
       if (*wrapped_var_data_ptr == nullptr) {
-        is_type = type == "Null";
+        is_type = type_id == kNullTypeId;
       } else {
         auto wrapped_var_vtable = data.virtual_table_repository.GetByIndex(
             static_cast<ovum::vm::runtime::ObjectDescriptor*>(*wrapped_var_data_ptr)->vtable_index);
@@ -2267,7 +2416,7 @@ std::expected<ExecutionResult, std::runtime_error> IsType(PassedExecutionData& d
           return std::unexpected(wrapped_var_vtable.error());
         }
 
-        is_type = wrapped_var_vtable.value()->GetName() == type;
+        is_type = wrapped_var_vtable.value()->GetTypeId() == type_id;
       }
     }
   }
@@ -2332,9 +2481,9 @@ std::expected<ExecutionResult, std::runtime_error> Interop(PassedExecutionData&
   }
 
   void* library_name_obj = library_name_arg.value();
-  auto* library_name_str = runtime::GetDataPointer<std::string>(library_name_obj);
+  std::string library_name = runtime::GetDataPointer<const runtime::String>(library_name_obj)->ToStdString();
   void* function_name_obj = function_name_arg.value();
-  auto* function_name_str = runtime::GetDataPointer<std::string>(function_name_obj);
+  std::string function_name = runtime::GetDataPointer<const runtime::String>(function_name_obj)->ToStdString();
 
   void* input_array_obj = input_array_arg.value();
   auto* input_byte_array = runtime::GetDataPointer<runtime::ByteArray>(input_array_obj);
@@ -2344,30 +2493,30 @@ std::expected<ExecutionResult, std::runtime_error> Interop(PassedExecutionData&
   using FunctionPtr = long long (*)(void*, unsigned long long, void*, unsigned long long);
 
 #ifdef _WIN32
-  HMODULE handle = LoadLibraryA(library_name_str->c_str());
+  HMODULE handle = LoadLibraryA(library_name.c_str());
   if (!handle) {
-    return std::unexpected(std::runtime_error("Interop: failed to load library " + *library_name_str));
+    return std::unexpected(std::runtime_error("Interop: failed to load library " + library_name));
   }
 
-  auto func = reinterpret_cast<FunctionPtr>(GetProcAddress(handle, function_name_str->c_str()));
+  auto func = reinterpret_cast<FunctionPtr>(GetProcAddress(handle, function_name.c_str()));
   if (!func) {
     FreeLibrary(handle);
-    return std::unexpected(std::runtime_error("Interop: failed to find function " + *function_name_str +
-                                              " in library " + *library_name_str));
+    return std::unexpected(std::runtime_error("Interop: failed to find function " + function_name +
+                                              " in library " + library_name));
   }
 #else
-  void* handle = dlopen(library_name_str->c_str(), RTLD_NOW);
+  void* handle = dlopen(library_name.c_str(), RTLD_NOW);
   if (!handle) {
     return std::unexpected(
-        std::runtime_error("Interop: failed to load library " + *library_name_str + ": " + dlerror()));
+        std::runtime_error("Interop: failed to load library " + library_name + ": " + dlerror()));
   }
 
-  auto func = reinterpret_cast<FunctionPtr>(dlsym(handle, function_name_str->c_str()));
+  auto func = reinterpret_cast<FunctionPtr>(dlsym(handle, function_name.c_str()));
   if (!func) {
     const char* error = dlerror();
     dlclose(handle);
-    return std::unexpected(std::runtime_error("Interop: failed to find function " + *function_name_str +
-                                              " in library " + *library_name_str + ": " +
+    return std::unexpected(std::runtime_error("Interop: failed to find function " + function_name +
+                                              " in library " + library_name + ": " +
                                               (error ? error : "unknown error")));
   }
 #endif
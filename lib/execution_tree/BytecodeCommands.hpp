@@ -3,6 +3,7 @@
 
 #include <cstdint>
 #include <expected>
+#include <istream>
 #include <stdexcept>
 #include <string>
 
@@ -17,7 +18,16 @@ std::expected<ExecutionResult, std::runtime_error> PushBool(PassedExecutionData&
 std::expected<ExecutionResult, std::runtime_error> PushChar(PassedExecutionData& data, char value);
 std::expected<ExecutionResult, std::runtime_error> PushByte(PassedExecutionData& data, uint8_t value);
 std::expected<ExecutionResult, std::runtime_error> PushString(PassedExecutionData& data, const std::string& value);
+// Interns the literal on every execution; the parser builds PushInternedString instead when it is given a pool
+std::expected<ExecutionResult, std::runtime_error> PushStringLiteral(PassedExecutionData& data,
+                                                                     const std::string& literal);
+// Pushes a String the parser already took from the pool, without looking the literal up
+std::expected<ExecutionResult, std::runtime_error> PushInternedString(PassedExecutionData& data, void* string_obj);
 std::expected<ExecutionResult, std::runtime_error> PushNull(PassedExecutionData& data);
+// Wraps value into a new Nullable; null values share one immortal instance
+std::expected<ExecutionResult, std::runtime_error> PushNullable(PassedExecutionData& data, void* value);
+// A read that is about to block is an idle point for the collector; reads served from the stream buffer skip it
+std::expected<void, std::runtime_error> CollectGarbageBeforeRead(PassedExecutionData& data, std::istream& stream);
 std::expected<ExecutionResult, std::runtime_error> Pop(PassedExecutionData& data);
 std::expected<ExecutionResult, std::runtime_error> Dup(PassedExecutionData& data);
 std::expected<ExecutionResult, std::runtime_error> Swap(PassedExecutionData& data);
@@ -112,6 +122,7 @@ std::expected<ExecutionResult, std::runtime_error> BoolToByte(PassedExecutionDat
 std::expected<ExecutionResult, std::runtime_error> Call(PassedExecutionData& data, const std::string& function);
 std::expected<ExecutionResult, std::runtime_error> CallIndirect(PassedExecutionData& data);
 std::expected<ExecutionResult, std::runtime_error> CallVirtual(PassedExecutionData& data, const std::string& method);
+std::expected<ExecutionResult, std::runtime_error> CallVirtualBySlot(PassedExecutionData& data, size_t slot);
 std::expected<ExecutionResult, std::runtime_error> Return(PassedExecutionData& data);
 std::expected<ExecutionResult, std::runtime_error> Break(PassedExecutionData& data);
 std::expected<ExecutionResult, std::runtime_error> Continue(PassedExecutionData& data);
@@ -128,6 +139,17 @@ std::expected<ExecutionResult, std::runtime_error> SafeCall(PassedExecutionData&
 std::expected<ExecutionResult, std::runtime_error> NullCoalesce(PassedExecutionData& data);
 std::expected<ExecutionResult, std::runtime_error> IsNull(PassedExecutionData& data);
 
+// Fused forms of an allocation whose only consumer is the next command. The object never escapes, so the value it
+// would wrap is used directly and nothing is allocated; see CreateFusedAllocationCommand
+std::expected<ExecutionResult, std::runtime_error> UnwrapFreshInt(PassedExecutionData& data);
+std::expected<ExecutionResult, std::runtime_error> UnwrapFreshFloat(PassedExecutionData& data);
+std::expected<ExecutionResult, std::runtime_error> UnwrapFreshChar(PassedExecutionData& data);
+std::expected<ExecutionResult, std::runtime_error> UnwrapFreshByte(PassedExecutionData& data);
+std::expected<ExecutionResult, std::runtime_error> UnwrapFreshBool(PassedExecutionData& data);
+std::expected<ExecutionResult, std::runtime_error> UnwrapFreshNullable(PassedExecutionData& data);
+std::expected<ExecutionResult, std::runtime_error> IsNullFreshNullable(PassedExecutionData& data);
+std::expected<ExecutionResult, std::runtime_error> NullCoalesceFreshNullable(PassedExecutionData& data);
+
 std::expected<ExecutionResult, std::runtime_error> Print(PassedExecutionData& data);
 std::expected<ExecutionResult, std::runtime_error> PrintLine(PassedExecutionData& data);
 std::expected<ExecutionResult, std::runtime_error> ReadLine(PassedExecutionData& data);
@@ -179,6 +201,7 @@ std::expected<ExecutionResult, std::runtime_error> GetHomeDir(PassedExecutionDat
 
 std::expected<ExecutionResult, std::runtime_error> TypeOf(PassedExecutionData& data);
 std::expected<ExecutionResult, std::runtime_error> IsType(PassedExecutionData& data, const std::string& type);
+std::expected<ExecutionResult, std::runtime_error> IsTypeById(PassedExecutionData& data, size_t type_id);
 std::expected<ExecutionResult, std::runtime_error> SizeOf(PassedExecutionData& data, const std::string& type);
 
 std::expected<ExecutionResult, std::runtime_error> Interop(PassedExecutionData& data);
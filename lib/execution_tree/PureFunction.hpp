@@ -17,6 +17,7 @@
 #include "IFunctionExecutable.hpp"
 #include "PassedExecutionData.hpp"
 #include "lib/runtime/ObjectDescriptor.hpp"
+#include "lib/runtime/TypeIds.hpp"
 #include "lib/runtime/Variable.hpp"
 #include "lib/runtime/VirtualTableRepository.hpp"
 
@@ -55,6 +56,12 @@ public:
     if (argument_type_names_.size() != function_.GetArity()) {
       throw std::runtime_error("PureFunction: argument type names count does not match function arity");
     }
+
+    argument_type_ids_.reserve(argument_type_names_.size());
+
+    for (const std::string& type_name : argument_type_names_) {
+      argument_type_ids_.push_back(runtime::TypeIds::GetOrAssign(type_name));
+    }
   }
 
   std::expected<ExecutionResult, std::runtime_error> Execute(PassedExecutionData& execution_data) override {
@@ -141,6 +148,7 @@ public:
 private:
   ExecutableFunctionType function_;
   std::vector<std::string> argument_type_names_;
+  std::vector<size_t> argument_type_ids_;
   std::unordered_map<CacheKey, runtime::Variable> cache_;
 
   [[nodiscard]] std::expected<size_t, std::runtime_error> GetHash(void* object_ptr,
@@ -247,7 +255,7 @@ private:
           return std::unexpected(std::runtime_error("PureFunction: failed to get VirtualTable for type checking"));
         }
 
-        type_matches = vtable_result.value()->IsType(expected_type);
+        type_matches = vtable_result.value()->IsType(argument_type_ids_[i]);
       } else {
         type_matches = (actual_type == expected_type);
       }
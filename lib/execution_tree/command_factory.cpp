@@ -7,6 +7,8 @@
 
 #include "BytecodeCommands.hpp"
 #include "Command.hpp"
+#include "lib/runtime/MethodSlots.hpp"
+#include "lib/runtime/TypeIds.hpp"
 
 namespace ovum::vm::execution_tree {
 
@@ -202,7 +204,7 @@ const std::unordered_map<std::string, SimpleCommandFunc>& GetSimpleCommands() {
 
 const std::unordered_map<std::string, StringCommandFunc>& GetStringCommands() {
   static const std::unordered_map<std::string, StringCommandFunc> kMap = {
-      {"PushString", bytecode::PushString},
+      {"PushString", bytecode::PushStringLiteral},
       {"Call", bytecode::Call},
       {"CallVirtual", bytecode::CallVirtual},
       {"CallConstructor", bytecode::CallConstructor},
@@ -266,6 +268,27 @@ const std::unordered_map<std::string, IntegerCommandFunc>& GetByteCommands() {
   return kMap;
 }
 
+// Keyed by "<allocation> <consumer>"
+const std::unordered_map<std::string, SimpleCommandFunc>& GetFusedAllocationCommands() {
+  static const std::unordered_map<std::string, SimpleCommandFunc> kMap = {
+      {"_Int_int Unwrap", bytecode::UnwrapFreshInt},
+      {"_Float_float Unwrap", bytecode::UnwrapFreshFloat},
+      {"_Char_char Unwrap", bytecode::UnwrapFreshChar},
+      {"_Byte_byte Unwrap", bytecode::UnwrapFreshByte},
+      {"_Bool_bool Unwrap", bytecode::UnwrapFreshBool},
+      {"_Nullable_Object Unwrap", bytecode::UnwrapFreshNullable},
+      {"_Nullable_Object IsNull", bytecode::IsNullFreshNullable},
+      {"_Nullable_Object NullCoalesce", bytecode::NullCoalesceFreshNullable},
+      {"PushNull IsNull", [](PassedExecutionData& data) { return bytecode::PushBool(data, true); }},
+      // Coalescing a fresh null keeps the default that is already on the stack
+      {"PushNull NullCoalesce",
+       [](PassedExecutionData&) -> std::expected<ExecutionResult, std::runtime_error> {
+         return ExecutionResult::kNormal;
+       }},
+  };
+  return kMap;
+}
+
 } // namespace
 
 std::expected<std::unique_ptr<IExecutable>, std::out_of_range> CreateSimpleCommandByName(const std::string& name) {
@@ -279,6 +302,15 @@ std::expected<std::unique_ptr<IExecutable>, std::out_of_range> CreateSimpleComma
 
 std::expected<std::unique_ptr<IExecutable>, std::out_of_range> CreateStringCommandByName(const std::string& name,
                                                                                          const std::string& value) {
+  // Names are resolved to their slot or type number once, so the command itself only indexes or compares
+  if (name == "CallVirtual") {
+    return CreateCommandWithArg(&bytecode::CallVirtualBySlot, runtime::MethodSlots::GetOrAssign(value));
+  }
+
+  if (name == "IsType") {
+    return CreateCommandWithArg(&bytecode::IsTypeById, runtime::TypeIds::GetOrAssign(value));
+  }
+
   const auto& map = GetStringCommands();
   try {
     return CreateCommandWithArg(map.at(name), value);
@@ -287,6 +319,10 @@ std::expected<std::unique_ptr<IExecutable>, std::out_of_range> CreateStringComma
   }
 }
 
+std::unique_ptr<IExecutable> CreateInternedStringCommand(void* string_obj) {
+  return CreateCommandWithArg(&bytecode::PushInternedString, string_obj);
+}
+
 std::expected<std::unique_ptr<IExecutable>, std::out_of_range> CreateIntegerCommandByName(const std::string& name,
                                                                                           const int64_t value) {
   const auto& map = GetIntegerCommands();
@@ -332,4 +368,16 @@ std::expected<std::unique_ptr<IExecutable>, std::out_of_range> CreateBooleanComm
   }
 }
 
+std::expected<std::unique_ptr<IExecutable>, std::out_of_range> CreateFusedAllocationCommand(
+    const std::string& allocation, const std::string& consumer) {
+  const auto& map = GetFusedAllocationCommands();
+  auto it = map.find(allocation + " " + consumer);
+
+  if (it == map.end()) {
+    return std::unexpected(std::out_of_range("Allocation cannot be fused: " + allocation + " " + consumer));
+  }
+
+  return std::make_unique<Command<SimpleCommandFunc>>(it->second);
+}
+
 } // namespace ovum::vm::execution_tree
@@ -27,6 +27,13 @@ std::expected<std::unique_ptr<IExecutable>, std::out_of_range> CreateSimpleComma
 std::expected<std::unique_ptr<IExecutable>, std::out_of_range> CreateStringCommandByName(const std::string& name,
                                                                                          const std::string& value);
 
+/**
+ * Creates the PushString command for a literal the parser interned, which pushes the pooled object as is.
+ * @param string_obj The immortal String object from the run's string pool.
+ * @return The command unique pointer.
+ */
+std::unique_ptr<IExecutable> CreateInternedStringCommand(void* string_obj);
+
 /**
  * Creates an integer-argument command by name (Ovum types Int, Char, Byte or an index).
  * @param name The name of the command.
@@ -54,6 +61,17 @@ std::expected<std::unique_ptr<IExecutable>, std::out_of_range> CreateFloatComman
 std::expected<std::unique_ptr<IExecutable>, std::out_of_range> CreateBooleanCommandByName(const std::string& name,
                                                                                           const bool value);
 
+/**
+ * Creates the fused command for an allocation immediately consumed by the next command, such as
+ * CallConstructor _Int_int followed by Unwrap. The object cannot escape between the two, so the fused command
+ * works on the value directly and allocates nothing.
+ * @param allocation The allocating command: "PushNull" or the constructor named by CallConstructor.
+ * @param consumer The simple command that follows it.
+ * @return The fused command or std::out_of_range if the pair cannot be fused.
+ */
+std::expected<std::unique_ptr<IExecutable>, std::out_of_range> CreateFusedAllocationCommand(
+    const std::string& allocation, const std::string& consumer);
+
 } // namespace ovum::vm::execution_tree
 
 #endif // EXECUTION_TREE_COMMANDFACTORY_HPP
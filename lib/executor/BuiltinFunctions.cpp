@@ -7,13 +7,20 @@
 #include <ios>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "lib/execution_tree/BytecodeCommands.hpp"
 #include "lib/execution_tree/ExecutionResult.hpp"
 #include "lib/execution_tree/PassedExecutionData.hpp"
+#include "lib/runtime/BoxCache.hpp"
 #include "lib/runtime/ByteArray.hpp"
+#include "lib/runtime/String.hpp"
 #include "lib/runtime/Variable.hpp"
 #include "lib/runtime/VirtualTable.hpp"
+#include "lib/runtime/gc/reference_scanners/WeakReferenceScanner.hpp"
 
 namespace ovum::vm::runtime {
 
@@ -109,6 +116,11 @@ std::expected<ExecutionResult, std::runtime_error> FundamentalTypeCopyAssignment
   }
 
   void* obj_ptr = std::get<void*>(data.memory.stack_frames.top().local_variables[0]);
+
+  if (runtime::BoxCache::IsImmortal(obj_ptr)) {
+    return std::unexpected(std::runtime_error("CopyAssignment: cannot assign to a shared box"));
+  }
+
   void* source_obj = std::get<void*>(data.memory.stack_frames.top().local_variables[1]);
   const T* source_data = runtime::GetDataPointer<const T>(source_obj);
   T* data_ptr = runtime::GetDataPointer<T>(obj_ptr);
@@ -128,6 +140,11 @@ std::expected<ExecutionResult, std::runtime_error> FundamentalTypeCopyAssignment
   }
 
   void* obj_ptr = std::get<void*>(data.memory.stack_frames.top().local_variables[0]);
+
+  if (runtime::BoxCache::IsImmortal(obj_ptr)) {
+    return std::unexpected(std::runtime_error("CopyAssignmentFromFundamental: cannot assign to a shared box"));
+  }
+
   T value = std::get<T>(data.memory.stack_frames.top().local_variables[1]);
   T* data_ptr = runtime::GetDataPointer<T>(obj_ptr);
   *data_ptr = value;
@@ -211,31 +228,14 @@ std::expected<ExecutionResult, std::runtime_error> FundamentalTypeToString(Passe
   void* obj_ptr = std::get<void*>(data.memory.stack_frames.top().local_variables[0]);
   const T* value = runtime::GetDataPointer<const T>(obj_ptr);
 
-  // Create String object
-  auto vtable_result = data.virtual_table_repository.GetByName("String");
-
-  if (!vtable_result.has_value()) {
-    return std::unexpected(std::runtime_error("ToString: String vtable not found"));
-  }
-
-  const runtime::VirtualTable* string_vtable = vtable_result.value();
-  auto vtable_index_result = data.virtual_table_repository.GetIndexByName("String");
-
-  if (!vtable_index_result.has_value()) {
-    return std::unexpected(vtable_index_result.error());
-  }
-
   auto string_obj_result =
-      data.memory_manager.AllocateObject(*string_vtable, static_cast<uint32_t>(vtable_index_result.value()), data);
+      runtime::AllocateBuiltin<runtime::String>(data, runtime::BuiltinType::kString, to_string_func(*value));
 
   if (!string_obj_result.has_value()) {
     return std::unexpected(string_obj_result.error());
   }
 
-  void* string_obj = string_obj_result.value();
-  auto* string_data = runtime::GetDataPointer<std::string>(string_obj);
-  new (string_data) std::string(std::move(to_string_func(*value))); // Move to avoid copying
-  data.memory.machine_stack.emplace(string_obj);
+  data.memory.machine_stack.emplace(string_obj_result.value());
 
   return ExecutionResult::kNormal;
 }
@@ -277,6 +277,7 @@ std::expected<ExecutionResult, std::runtime_error> ArrayConstructor(PassedExecut
   T default_value = std::get<T>(data.memory.stack_frames.top().local_variables[2]);
   auto* vec_data = runtime::GetDataPointer<std::vector<T>>(obj_ptr);
   new (vec_data) std::vector<T>(static_cast<size_t>(size), default_value);
+  data.memory_manager.ReportExternalMemory(obj_ptr, runtime::ExternalBytes(*vec_data));
   data.memory.machine_stack.emplace(obj_ptr);
 
   return ExecutionResult::kNormal;
@@ -296,7 +297,9 @@ std::expected<ExecutionResult, std::runtime_error> ArrayConstructor<void*>(Passe
   int64_t size = std::get<int64_t>(data.memory.stack_frames.top().local_variables[1]);
   void* default_value = std::get<void*>(data.memory.stack_frames.top().local_variables[2]);
   auto* vec_data = runtime::GetDataPointer<std::vector<void*>>(obj_ptr);
+  data.memory_manager.WriteBarrier(default_value);
   new (vec_data) std::vector<void*>(static_cast<size_t>(size), default_value);
+  data.memory_manager.ReportExternalMemory(obj_ptr, runtime::ExternalBytes(*vec_data));
   data.memory.machine_stack.emplace(obj_ptr);
 
   return ExecutionResult::kNormal;
@@ -316,6 +319,14 @@ std::expected<ExecutionResult, std::runtime_error> ArrayCopyConstructor(PassedEx
   const auto* source_vec = runtime::GetDataPointer<const std::vector<T>>(source_obj);
   auto* vec_data = runtime::GetDataPointer<std::vector<T>>(obj_ptr);
   new (vec_data) std::vector<T>(*source_vec);
+  data.memory_manager.ReportExternalMemory(obj_ptr, runtime::ExternalBytes(*vec_data));
+
+  if constexpr (std::is_same_v<T, void*>) {
+    for (void* ref : *vec_data) {
+      data.memory_manager.WriteBarrier(ref);
+    }
+  }
+
   data.memory.machine_stack.emplace(obj_ptr);
 
   return ExecutionResult::kNormal;
@@ -335,6 +346,13 @@ std::expected<ExecutionResult, std::runtime_error> ArrayCopyAssignment(PassedExe
   const auto* source_vec = runtime::GetDataPointer<const std::vector<T>>(source_obj);
   auto* vec_data = runtime::GetDataPointer<std::vector<T>>(obj_ptr);
   *vec_data = *source_vec;
+  data.memory_manager.ReportExternalMemory(obj_ptr, runtime::ExternalBytes(*vec_data));
+
+  if constexpr (std::is_same_v<T, void*>) {
+    for (void* ref : *vec_data) {
+      data.memory_manager.WriteBarrier(ref);
+    }
+  }
 
   return ExecutionResult::kNormal;
 }
@@ -465,6 +483,7 @@ std::expected<ExecutionResult, std::runtime_error> ArrayShrinkToFit(PassedExecut
   void* obj_ptr = std::get<void*>(data.memory.stack_frames.top().local_variables[0]);
   auto* vec = runtime::GetDataPointer<std::vector<T>>(obj_ptr);
   vec->shrink_to_fit();
+  data.memory_manager.ReportExternalMemory(obj_ptr, runtime::ExternalBytes(*vec));
 
   return ExecutionResult::kNormal;
 }
@@ -482,6 +501,7 @@ std::expected<ExecutionResult, std::runtime_error> ArrayReserve(PassedExecutionD
   int64_t capacity = std::get<int64_t>(data.memory.stack_frames.top().local_variables[1]);
   auto* vec = runtime::GetDataPointer<std::vector<T>>(obj_ptr);
   vec->reserve(static_cast<size_t>(capacity));
+  data.memory_manager.ReportExternalMemory(obj_ptr, runtime::ExternalBytes(*vec));
 
   return ExecutionResult::kNormal;
 }
@@ -515,6 +535,7 @@ std::expected<ExecutionResult, std::runtime_error> ArrayAdd(PassedExecutionData&
   T value = std::get<T>(data.memory.stack_frames.top().local_variables[1]);
   auto* vec = runtime::GetDataPointer<std::vector<T>>(obj_ptr);
   vec->push_back(value);
+  data.memory_manager.ReportExternalMemory(obj_ptr, runtime::ExternalBytes(*vec));
 
   return ExecutionResult::kNormal;
 }
@@ -530,7 +551,9 @@ std::expected<ExecutionResult, std::runtime_error> ArrayAdd<void*>(PassedExecuti
   void* obj_ptr = std::get<void*>(data.memory.stack_frames.top().local_variables[0]);
   void* value = std::get<void*>(data.memory.stack_frames.top().local_variables[1]);
   auto* vec = runtime::GetDataPointer<std::vector<void*>>(obj_ptr);
+  data.memory_manager.WriteBarrier(value);
   vec->push_back(value);
+  data.memory_manager.ReportExternalMemory(obj_ptr, runtime::ExternalBytes(*vec));
 
   return ExecutionResult::kNormal;
 }
@@ -599,6 +622,7 @@ std::expected<ExecutionResult, std::runtime_error> ArrayInsertAt(PassedExecution
   }
 
   vec->insert(vec->begin() + static_cast<ptrdiff_t>(circular_index), value);
+  data.memory_manager.ReportExternalMemory(obj_ptr, runtime::ExternalBytes(*vec));
 
   return ExecutionResult::kNormal;
 }
@@ -637,7 +661,9 @@ std::expected<ExecutionResult, std::runtime_error> ArrayInsertAt<void*>(PassedEx
     }
   }
 
+  data.memory_manager.WriteBarrier(value);
   vec->insert(vec->begin() + static_cast<ptrdiff_t>(circular_index), value);
+  data.memory_manager.ReportExternalMemory(obj_ptr, runtime::ExternalBytes(*vec));
   return ExecutionResult::kNormal;
 }
 
@@ -694,6 +720,7 @@ std::expected<ExecutionResult, std::runtime_error> ArraySetAt<void*>(PassedExecu
   size_t circular_index = ((static_cast<int64_t>(index % static_cast<int64_t>(size)) + static_cast<int64_t>(size)) %
                            static_cast<int64_t>(size));
 
+  data.memory_manager.WriteBarrier(value);
   (*vec)[circular_index] = value;
   return ExecutionResult::kNormal;
 }
@@ -754,6 +781,48 @@ std::expected<ExecutionResult, std::runtime_error> ArrayGetAt<void*>(PassedExecu
   return ExecutionResult::kNormal;
 }
 
+// Helpers for WeakRef and SoftRef: the referent is stored without a write barrier because the collector never
+// traces it
+// Arguments: reference is first, referent is second
+inline std::expected<ExecutionResult, std::runtime_error> ReferenceConstructor(PassedExecutionData& data,
+                                                                               const std::string& type_name) {
+  if (!std::holds_alternative<void*>(data.memory.stack_frames.top().local_variables[0]) ||
+      !std::holds_alternative<void*>(data.memory.stack_frames.top().local_variables[1])) {
+    return std::unexpected(std::runtime_error(type_name + "::Constructor: invalid argument types"));
+  }
+
+  void* obj_ptr = std::get<void*>(data.memory.stack_frames.top().local_variables[0]);
+  void* referent = std::get<void*>(data.memory.stack_frames.top().local_variables[1]);
+  runtime::WeakReferenceScanner::Referent(obj_ptr) = referent;
+  data.memory.machine_stack.emplace(obj_ptr);
+
+  return ExecutionResult::kNormal;
+}
+
+// Pushes Nullable with the referent, or null once the collector has cleared it
+inline std::expected<ExecutionResult, std::runtime_error> ReferenceGet(PassedExecutionData& data,
+                                                                       const std::string& type_name) {
+  if (!std::holds_alternative<void*>(data.memory.stack_frames.top().local_variables[0])) {
+    return std::unexpected(std::runtime_error(type_name + "::Get: invalid argument types"));
+  }
+
+  void* obj_ptr = std::get<void*>(data.memory.stack_frames.top().local_variables[0]);
+
+  return bytecode::PushNullable(data, runtime::WeakReferenceScanner::Referent(obj_ptr));
+}
+
+inline std::expected<ExecutionResult, std::runtime_error> ReferenceIsAlive(PassedExecutionData& data,
+                                                                           const std::string& type_name) {
+  if (!std::holds_alternative<void*>(data.memory.stack_frames.top().local_variables[0])) {
+    return std::unexpected(std::runtime_error(type_name + "::IsAlive: invalid argument types"));
+  }
+
+  void* obj_ptr = std::get<void*>(data.memory.stack_frames.top().local_variables[0]);
+  data.memory.machine_stack.emplace(runtime::WeakReferenceScanner::Referent(obj_ptr) != nullptr);
+
+  return ExecutionResult::kNormal;
+}
+
 } // namespace ovum::vm::execution_tree
 
 namespace ovum::vm::execution_tree {
@@ -975,8 +1044,14 @@ std::expected<ExecutionResult, std::runtime_error> NullableConstructor(PassedExe
   }
 
   void* obj_ptr = std::get<void*>(data.memory.stack_frames.top().local_variables[0]);
+
+  if (runtime::BoxCache::IsImmortal(obj_ptr)) {
+    return std::unexpected(std::runtime_error("Nullable::Constructor: cannot initialize the shared null"));
+  }
+
   void* value_ptr = std::get<void*>(data.memory.stack_frames.top().local_variables[1]);
   auto* nullable_data = runtime::GetDataPointer<void*>(obj_ptr);
+  data.memory_manager.WriteBarrier(value_ptr);
   *nullable_data = value_ptr;
   data.memory.machine_stack.emplace(obj_ptr);
 
@@ -987,6 +1062,38 @@ std::expected<ExecutionResult, std::runtime_error> NullableDestructor(PassedExec
   return FundamentalTypeDestructor<void*>(data);
 }
 
+std::expected<ExecutionResult, std::runtime_error> WeakRefConstructor(PassedExecutionData& data) {
+  return ReferenceConstructor(data, "WeakRef");
+}
+
+std::expected<ExecutionResult, std::runtime_error> WeakRefDestructor(PassedExecutionData& data) {
+  return FundamentalTypeDestructor<void*>(data);
+}
+
+std::expected<ExecutionResult, std::runtime_error> WeakRefGet(PassedExecutionData& data) {
+  return ReferenceGet(data, "WeakRef");
+}
+
+std::expected<ExecutionResult, std::runtime_error> WeakRefIsAlive(PassedExecutionData& data) {
+  return ReferenceIsAlive(data, "WeakRef");
+}
+
+std::expected<ExecutionResult, std::runtime_error> SoftRefConstructor(PassedExecutionData& data) {
+  return ReferenceConstructor(data, "SoftRef");
+}
+
+std::expected<ExecutionResult, std::runtime_error> SoftRefDestructor(PassedExecutionData& data) {
+  return FundamentalTypeDestructor<void*>(data);
+}
+
+std::expected<ExecutionResult, std::runtime_error> SoftRefGet(PassedExecutionData& data) {
+  return ReferenceGet(data, "SoftRef");
+}
+
+std::expected<ExecutionResult, std::runtime_error> SoftRefIsAlive(PassedExecutionData& data) {
+  return ReferenceIsAlive(data, "SoftRef");
+}
+
 std::expected<ExecutionResult, std::runtime_error> StringToString(PassedExecutionData& data) {
   if (!std::holds_alternative<void*>(data.memory.stack_frames.top().local_variables[0])) {
     return std::unexpected(std::runtime_error("String::ToString: invalid argument types"));
@@ -1005,8 +1112,8 @@ std::expected<ExecutionResult, std::runtime_error> StringGetHash(PassedExecution
   }
 
   void* obj_ptr = std::get<void*>(data.memory.stack_frames.top().local_variables[0]);
-  auto* str = runtime::GetDataPointer<std::string>(obj_ptr);
-  int64_t hash = static_cast<int64_t>(std::hash<std::string>{}(*str));
+  const auto* str = runtime::GetDataPointer<const runtime::String>(obj_ptr);
+  int64_t hash = static_cast<int64_t>(str->GetHash());
   data.memory.machine_stack.emplace(hash);
 
   return ExecutionResult::kNormal;
@@ -1018,8 +1125,8 @@ std::expected<ExecutionResult, std::runtime_error> StringLength(PassedExecutionD
   }
 
   void* obj_ptr = std::get<void*>(data.memory.stack_frames.top().local_variables[0]);
-  auto* str = runtime::GetDataPointer<std::string>(obj_ptr);
-  auto length = static_cast<int64_t>(str->length());
+  const auto* str = runtime::GetDataPointer<const runtime::String>(obj_ptr);
+  auto length = static_cast<int64_t>(str->Size());
   data.memory.machine_stack.emplace(length);
 
   return ExecutionResult::kNormal;
@@ -1031,24 +1138,11 @@ std::expected<ExecutionResult, std::runtime_error> StringToUtf8Bytes(PassedExecu
   }
 
   void* obj_ptr = std::get<void*>(data.memory.stack_frames.top().local_variables[0]);
-  auto* str = runtime::GetDataPointer<std::string>(obj_ptr);
-
-  // Create ByteArray object
-  auto vtable_result = data.virtual_table_repository.GetByName("ByteArray");
-
-  if (!vtable_result.has_value()) {
-    return std::unexpected(std::runtime_error("String::ToUtf8Bytes: ByteArray vtable not found"));
-  }
-
-  const runtime::VirtualTable* byte_array_vtable = vtable_result.value();
-  auto vtable_index_result = data.virtual_table_repository.GetIndexByName("ByteArray");
-
-  if (!vtable_index_result.has_value()) {
-    return std::unexpected(vtable_index_result.error());
-  }
+  const auto* str = runtime::GetDataPointer<const runtime::String>(obj_ptr);
 
+  // +1 for null terminator
   auto byte_array_obj_result =
-      data.memory_manager.AllocateObject(*byte_array_vtable, static_cast<uint32_t>(vtable_index_result.value()), data);
+      runtime::AllocateBuiltin<runtime::ByteArray>(data, runtime::BuiltinType::kByteArray, str->Size() + 1);
 
   if (!byte_array_obj_result.has_value()) {
     return std::unexpected(byte_array_obj_result.error());
@@ -1056,9 +1150,8 @@ std::expected<ExecutionResult, std::runtime_error> StringToUtf8Bytes(PassedExecu
 
   void* byte_array_obj = byte_array_obj_result.value();
   auto* byte_array_data = runtime::GetDataPointer<runtime::ByteArray>(byte_array_obj);
-  new (byte_array_data) runtime::ByteArray(str->size() + 1); // +1 for null terminator
-  byte_array_data->Data()[str->size()] = 0;
-  std::memcpy(byte_array_data->Data(), str->data(), str->size());
+  byte_array_data->Data()[str->Size()] = 0;
+  std::memcpy(byte_array_data->Data(), str->View().data(), str->Size());
   data.memory.machine_stack.emplace(byte_array_obj);
 
   return ExecutionResult::kNormal;
@@ -1074,9 +1167,10 @@ std::expected<ExecutionResult, std::runtime_error> StringCopyConstructor(PassedE
 
   void* obj_ptr = std::get<void*>(data.memory.stack_frames.top().local_variables[0]);
   void* source_obj = std::get<void*>(data.memory.stack_frames.top().local_variables[1]);
-  const auto* source_string = runtime::GetDataPointer<const std::string>(source_obj);
-  auto* string_data = runtime::GetDataPointer<std::string>(obj_ptr);
-  new (string_data) std::string(*source_string);
+  const auto* source_string = runtime::GetDataPointer<const runtime::String>(source_obj);
+  auto* string_data = runtime::GetDataPointer<runtime::String>(obj_ptr);
+  new (string_data) runtime::String(*source_string);
+  data.memory_manager.ReportExternalMemory(obj_ptr, runtime::ExternalBytes(*string_data));
   data.memory.machine_stack.emplace(obj_ptr);
 
   return ExecutionResult::kNormal;
@@ -1089,10 +1183,16 @@ std::expected<ExecutionResult, std::runtime_error> StringCopyAssignment(PassedEx
   }
 
   void* obj_ptr = std::get<void*>(data.memory.stack_frames.top().local_variables[0]);
+
+  if (runtime::BoxCache::IsImmortal(obj_ptr)) {
+    return std::unexpected(std::runtime_error("String::CopyAssignment: cannot assign to an interned literal"));
+  }
+
   void* source_obj = std::get<void*>(data.memory.stack_frames.top().local_variables[1]);
-  const auto* source_string = runtime::GetDataPointer<const std::string>(source_obj);
-  auto* string_data = runtime::GetDataPointer<std::string>(obj_ptr);
+  const auto* source_string = runtime::GetDataPointer<const runtime::String>(source_obj);
+  auto* string_data = runtime::GetDataPointer<runtime::String>(obj_ptr);
   *string_data = *source_string;
+  data.memory_manager.ReportExternalMemory(obj_ptr, runtime::ExternalBytes(*string_data));
 
   return ExecutionResult::kNormal;
 }
@@ -1102,20 +1202,159 @@ std::expected<ExecutionResult, std::runtime_error> StringDestructor(PassedExecut
     return std::unexpected(std::runtime_error("String::Destructor: invalid argument types"));
   }
 
-  using string_type = std::string;
   void* obj_ptr = std::get<void*>(data.memory.stack_frames.top().local_variables[0]);
-  auto* string_data = runtime::GetDataPointer<std::string>(obj_ptr);
-  string_data->~string_type();
+  auto* string_data = runtime::GetDataPointer<runtime::String>(obj_ptr);
+  string_data->~String();
 
   return ExecutionResult::kNormal;
 }
 
 std::expected<ExecutionResult, std::runtime_error> StringEquals(PassedExecutionData& data) {
-  return FundamentalTypeEquals<std::string>(data);
+  return FundamentalTypeEquals<runtime::String>(data);
 }
 
 std::expected<ExecutionResult, std::runtime_error> StringIsLess(PassedExecutionData& data) {
-  return FundamentalTypeIsLess<std::string>(data);
+  return FundamentalTypeIsLess<runtime::String>(data);
+}
+
+// StringBuilder methods
+
+std::expected<ExecutionResult, std::runtime_error> StringBuilderConstructor(PassedExecutionData& data) {
+  if (!std::holds_alternative<void*>(data.memory.stack_frames.top().local_variables[0])) {
+    return std::unexpected(std::runtime_error("StringBuilder::Constructor: invalid argument types"));
+  }
+
+  void* obj_ptr = std::get<void*>(data.memory.stack_frames.top().local_variables[0]);
+  auto* builder = runtime::GetDataPointer<std::string>(obj_ptr);
+  new (builder) std::string();
+  data.memory.machine_stack.emplace(obj_ptr);
+
+  return ExecutionResult::kNormal;
+}
+
+std::expected<ExecutionResult, std::runtime_error> StringBuilderCopyConstructor(PassedExecutionData& data) {
+  if (!std::holds_alternative<void*>(data.memory.stack_frames.top().local_variables[0]) ||
+      !std::holds_alternative<void*>(data.memory.stack_frames.top().local_variables[1])) {
+    return std::unexpected(std::runtime_error("StringBuilder::CopyConstructor: invalid argument types"));
+  }
+
+  void* obj_ptr = std::get<void*>(data.memory.stack_frames.top().local_variables[0]);
+  void* source_obj = std::get<void*>(data.memory.stack_frames.top().local_variables[1]);
+  const auto* source_builder = runtime::GetDataPointer<const std::string>(source_obj);
+  auto* builder = runtime::GetDataPointer<std::string>(obj_ptr);
+  new (builder) std::string(*source_builder);
+  data.memory_manager.ReportExternalMemory(obj_ptr, runtime::ExternalBytes(*builder));
+  data.memory.machine_stack.emplace(obj_ptr);
+
+  return ExecutionResult::kNormal;
+}
+
+std::expected<ExecutionResult, std::runtime_error> StringBuilderCopyAssignment(PassedExecutionData& data) {
+  if (!std::holds_alternative<void*>(data.memory.stack_frames.top().local_variables[0]) ||
+      !std::holds_alternative<void*>(data.memory.stack_frames.top().local_variables[1])) {
+    return std::unexpected(std::runtime_error("StringBuilder::CopyAssignment: invalid argument types"));
+  }
+
+  void* obj_ptr = std::get<void*>(data.memory.stack_frames.top().local_variables[0]);
+  void* source_obj = std::get<void*>(data.memory.stack_frames.top().local_variables[1]);
+  const auto* source_builder = runtime::GetDataPointer<const std::string>(source_obj);
+  auto* builder = runtime::GetDataPointer<std::string>(obj_ptr);
+  *builder = *source_builder;
+  data.memory_manager.ReportExternalMemory(obj_ptr, runtime::ExternalBytes(*builder));
+
+  return ExecutionResult::kNormal;
+}
+
+std::expected<ExecutionResult, std::runtime_error> StringBuilderDestructor(PassedExecutionData& data) {
+  if (!std::holds_alternative<void*>(data.memory.stack_frames.top().local_variables[0])) {
+    return std::unexpected(std::runtime_error("StringBuilder::Destructor: invalid argument types"));
+  }
+
+  using string_type = std::string;
+  void* obj_ptr = std::get<void*>(data.memory.stack_frames.top().local_variables[0]);
+  auto* builder = runtime::GetDataPointer<std::string>(obj_ptr);
+  builder->~string_type();
+
+  return ExecutionResult::kNormal;
+}
+
+// Appends in place; std::string grows geometrically, so a sequence of appends costs amortized linear time
+// Arguments: builder is first, string is second
+std::expected<ExecutionResult, std::runtime_error> StringBuilderAppend(PassedExecutionData& data) {
+  if (!std::holds_alternative<void*>(data.memory.stack_frames.top().local_variables[0]) ||
+      !std::holds_alternative<void*>(data.memory.stack_frames.top().local_variables[1])) {
+    return std::unexpected(std::runtime_error("StringBuilder::Append: invalid argument types"));
+  }
+
+  void* obj_ptr = std::get<void*>(data.memory.stack_frames.top().local_variables[0]);
+  void* string_obj = std::get<void*>(data.memory.stack_frames.top().local_variables[1]);
+  const auto* piece = runtime::GetDataPointer<const runtime::String>(string_obj);
+  auto* builder = runtime::GetDataPointer<std::string>(obj_ptr);
+  builder->append(piece->View());
+  data.memory_manager.ReportExternalMemory(obj_ptr, runtime::ExternalBytes(*builder));
+
+  return ExecutionResult::kNormal;
+}
+
+// Arguments: builder is first, char is second
+std::expected<ExecutionResult, std::runtime_error> StringBuilderAppendChar(PassedExecutionData& data) {
+  if (!std::holds_alternative<void*>(data.memory.stack_frames.top().local_variables[0]) ||
+      !std::holds_alternative<char>(data.memory.stack_frames.top().local_variables[1])) {
+    return std::unexpected(std::runtime_error("StringBuilder::AppendChar: invalid argument types"));
+  }
+
+  void* obj_ptr = std::get<void*>(data.memory.stack_frames.top().local_variables[0]);
+  char value = std::get<char>(data.memory.stack_frames.top().local_variables[1]);
+  auto* builder = runtime::GetDataPointer<std::string>(obj_ptr);
+  builder->push_back(value);
+  data.memory_manager.ReportExternalMemory(obj_ptr, runtime::ExternalBytes(*builder));
+
+  return ExecutionResult::kNormal;
+}
+
+std::expected<ExecutionResult, std::runtime_error> StringBuilderLength(PassedExecutionData& data) {
+  if (!std::holds_alternative<void*>(data.memory.stack_frames.top().local_variables[0])) {
+    return std::unexpected(std::runtime_error("StringBuilder::Length: invalid argument types"));
+  }
+
+  void* obj_ptr = std::get<void*>(data.memory.stack_frames.top().local_variables[0]);
+  const auto* builder = runtime::GetDataPointer<const std::string>(obj_ptr);
+  data.memory.machine_stack.emplace(static_cast<int64_t>(builder->size()));
+
+  return ExecutionResult::kNormal;
+}
+
+std::expected<ExecutionResult, std::runtime_error> StringBuilderClear(PassedExecutionData& data) {
+  if (!std::holds_alternative<void*>(data.memory.stack_frames.top().local_variables[0])) {
+    return std::unexpected(std::runtime_error("StringBuilder::Clear: invalid argument types"));
+  }
+
+  void* obj_ptr = std::get<void*>(data.memory.stack_frames.top().local_variables[0]);
+  auto* builder = runtime::GetDataPointer<std::string>(obj_ptr);
+  builder->clear();
+
+  return ExecutionResult::kNormal;
+}
+
+// Arguments: builder is first, capacity is second
+std::expected<ExecutionResult, std::runtime_error> StringBuilderReserve(PassedExecutionData& data) {
+  if (!std::holds_alternative<void*>(data.memory.stack_frames.top().local_variables[0]) ||
+      !std::holds_alternative<int64_t>(data.memory.stack_frames.top().local_variables[1])) {
+    return std::unexpected(std::runtime_error("StringBuilder::Reserve: invalid argument types"));
+  }
+
+  void* obj_ptr = std::get<void*>(data.memory.stack_frames.top().local_variables[0]);
+  int64_t capacity = std::get<int64_t>(data.memory.stack_frames.top().local_variables[1]);
+  auto* builder = runtime::GetDataPointer<std::string>(obj_ptr);
+  builder->reserve(static_cast<size_t>(capacity));
+  data.memory_manager.ReportExternalMemory(obj_ptr, runtime::ExternalBytes(*builder));
+
+  return ExecutionResult::kNormal;
+}
+
+// Copies the accumulated text into a new String; the builder stays usable
+std::expected<ExecutionResult, std::runtime_error> StringBuilderToString(PassedExecutionData& data) {
+  return FundamentalTypeToString<std::string>(data, [](const std::string& value) { return value; });
 }
 
 std::expected<ExecutionResult, std::runtime_error> IntArrayLength(PassedExecutionData& data) {
@@ -1296,6 +1535,7 @@ std::expected<ExecutionResult, std::runtime_error> ByteArrayShrinkToFit(PassedEx
   void* obj_ptr = std::get<void*>(data.memory.stack_frames.top().local_variables[0]);
   auto* byte_array = runtime::GetDataPointer<runtime::ByteArray>(obj_ptr);
   byte_array->ShrinkToFit();
+  data.memory_manager.ReportExternalMemory(obj_ptr, runtime::ExternalBytes(*byte_array));
 
   return ExecutionResult::kNormal;
 }
@@ -1310,6 +1550,7 @@ std::expected<ExecutionResult, std::runtime_error> ByteArrayReserve(PassedExecut
   int64_t capacity = std::get<int64_t>(data.memory.stack_frames.top().local_variables[1]);
   auto* byte_array = runtime::GetDataPointer<runtime::ByteArray>(obj_ptr);
   byte_array->Reserve(static_cast<size_t>(capacity));
+  data.memory_manager.ReportExternalMemory(obj_ptr, runtime::ExternalBytes(*byte_array));
 
   return ExecutionResult::kNormal;
 }
@@ -1337,6 +1578,7 @@ std::expected<ExecutionResult, std::runtime_error> ByteArrayAdd(PassedExecutionD
   uint8_t value = std::get<uint8_t>(data.memory.stack_frames.top().local_variables[1]);
   auto* byte_array = runtime::GetDataPointer<runtime::ByteArray>(obj_ptr);
   byte_array->Insert(byte_array->Size(), value);
+  data.memory_manager.ReportExternalMemory(obj_ptr, runtime::ExternalBytes(*byte_array));
 
   return ExecutionResult::kNormal;
 }
@@ -1382,6 +1624,7 @@ std::expected<ExecutionResult, std::runtime_error> ByteArrayInsertAt(PassedExecu
   size_t circular_index = ComputeCircularIndex(index, size, true);
 
   byte_array->Insert(circular_index, value);
+  data.memory_manager.ReportExternalMemory(obj_ptr, runtime::ExternalBytes(*byte_array));
 
   return ExecutionResult::kNormal;
 }
@@ -1629,24 +1872,24 @@ std::expected<ExecutionResult, std::runtime_error> FileOpen(PassedExecutionData&
   void* file_obj = std::get<void*>(data.memory.stack_frames.top().local_variables[0]);
   void* path_obj = std::get<void*>(data.memory.stack_frames.top().local_variables[1]);
   void* mode_obj = std::get<void*>(data.memory.stack_frames.top().local_variables[2]);
-  auto* path = runtime::GetDataPointer<std::string>(path_obj);
-  auto* mode = runtime::GetDataPointer<std::string>(mode_obj);
+  std::string path = runtime::GetDataPointer<const runtime::String>(path_obj)->ToStdString();
+  std::string_view mode = runtime::GetDataPointer<const runtime::String>(mode_obj)->View();
   auto* file = runtime::GetDataPointer<std::fstream>(file_obj);
 
   // Parse mode string
   std::ios_base::openmode open_mode = std::ios_base::in | std::ios_base::out;
 
-  if (*mode == "r") {
+  if (mode == "r") {
     open_mode = std::ios_base::in;
-  } else if (*mode == "w") {
+  } else if (mode == "w") {
     open_mode = std::ios_base::out | std::ios_base::trunc;
-  } else if (*mode == "a") {
+  } else if (mode == "a") {
     open_mode = std::ios_base::out | std::ios_base::app;
-  } else if (*mode == "r+") {
+  } else if (mode == "r+") {
     open_mode = std::ios_base::in | std::ios_base::out;
-  } else if (*mode == "w+") {
+  } else if (mode == "w+") {
     open_mode = std::ios_base::in | std::ios_base::out | std::ios_base::trunc;
-  } else if (*mode == "a+") {
+  } else if (mode == "a+") {
     open_mode = std::ios_base::in | std::ios_base::out | std::ios_base::app;
   }
 
@@ -1656,10 +1899,10 @@ std::expected<ExecutionResult, std::runtime_error> FileOpen(PassedExecutionData&
   }
 
   // Open file
-  file->open(*path, open_mode);
+  file->open(path, open_mode);
 
   if (!file->is_open()) {
-    return std::unexpected(std::runtime_error("File::Open: failed to open file: " + *path));
+    return std::unexpected(std::runtime_error("File::Open: failed to open file: " + path));
   }
 
   return ExecutionResult::kNormal;
@@ -1785,6 +2028,7 @@ std::expected<ExecutionResult, std::runtime_error> ByteArrayConstructor(PassedEx
   if (size > 0) {
     std::memset(byte_array_data->Data(), default_value, static_cast<size_t>(size));
   }
+  data.memory_manager.ReportExternalMemory(obj_ptr, runtime::ExternalBytes(*byte_array_data));
   data.memory.machine_stack.emplace(obj_ptr);
 
   return ExecutionResult::kNormal;
@@ -1801,6 +2045,7 @@ std::expected<ExecutionResult, std::runtime_error> ByteArrayCopyConstructor(Pass
   const auto* source_byte_array = runtime::GetDataPointer<const runtime::ByteArray>(source_obj);
   auto* byte_array_data = runtime::GetDataPointer<runtime::ByteArray>(obj_ptr);
   new (byte_array_data) runtime::ByteArray(*source_byte_array);
+  data.memory_manager.ReportExternalMemory(obj_ptr, runtime::ExternalBytes(*byte_array_data));
   data.memory.machine_stack.emplace(obj_ptr);
 
   return ExecutionResult::kNormal;
@@ -1816,7 +2061,13 @@ std::expected<ExecutionResult, std::runtime_error> ByteArrayCopyAssignment(Passe
   void* source_obj = std::get<void*>(data.memory.stack_frames.top().local_variables[1]);
   const auto* source_byte_array = runtime::GetDataPointer<const runtime::ByteArray>(source_obj);
   auto* byte_array_data = runtime::GetDataPointer<runtime::ByteArray>(obj_ptr);
+
+  if (byte_array_data->IsView() && byte_array_data != source_byte_array) {
+    data.memory_manager.Unpin(byte_array_data->Data());
+  }
+
   *byte_array_data = *source_byte_array;
+  data.memory_manager.ReportExternalMemory(obj_ptr, runtime::ExternalBytes(*byte_array_data));
 
   return ExecutionResult::kNormal;
 }
@@ -1829,6 +2080,11 @@ std::expected<ExecutionResult, std::runtime_error> ByteArrayDestructor(PassedExe
   using byte_array_type = runtime::ByteArray;
   void* obj_ptr = std::get<void*>(data.memory.stack_frames.top().local_variables[0]);
   auto* byte_array_data = runtime::GetDataPointer<runtime::ByteArray>(obj_ptr);
+
+  if (byte_array_data->IsView()) {
+    data.memory_manager.Unpin(byte_array_data->Data());
+  }
+
   byte_array_data->~byte_array_type();
 
   return ExecutionResult::kNormal;
@@ -1908,7 +2164,9 @@ std::expected<ExecutionResult, std::runtime_error> ByteArrayFromObject(PassedExe
   auto* byte_array_data = runtime::GetDataPointer<runtime::ByteArray>(obj_ptr);
 
   // Create a view of the entire source object (including ObjectDescriptor)
+  // The view hands out the object's address, so the object must stay in place while the view exists
   new (byte_array_data) runtime::ByteArray(source_obj, object_size);
+  data.memory_manager.Pin(source_obj);
   data.memory.machine_stack.emplace(obj_ptr);
 
   return ExecutionResult::kNormal;
@@ -1952,7 +2210,9 @@ std::expected<ExecutionResult, std::runtime_error> ObjectArrayConstructor(Passed
   int64_t size = std::get<int64_t>(data.memory.stack_frames.top().local_variables[1]);
   void* default_value = std::get<void*>(data.memory.stack_frames.top().local_variables[2]);
   auto* vec_data = runtime::GetDataPointer<std::vector<void*>>(obj_ptr);
+  data.memory_manager.WriteBarrier(default_value);
   new (vec_data) std::vector<void*>(static_cast<size_t>(size), default_value);
+  data.memory_manager.ReportExternalMemory(obj_ptr, runtime::ExternalBytes(*vec_data));
   data.memory.machine_stack.emplace(obj_ptr);
 
   return ExecutionResult::kNormal;
@@ -2074,22 +2334,8 @@ std::expected<ExecutionResult, std::runtime_error> FileRead(PassedExecutionData&
   auto bytes_read = static_cast<size_t>(file->gcount());
   buffer.resize(bytes_read);
 
-  // Create ByteArray object
-  auto vtable_result = data.virtual_table_repository.GetByName("ByteArray");
-
-  if (!vtable_result.has_value()) {
-    return std::unexpected(std::runtime_error("File::Read: ByteArray vtable not found"));
-  }
-
-  const runtime::VirtualTable* byte_array_vtable = vtable_result.value();
-  auto vtable_index_result = data.virtual_table_repository.GetIndexByName("ByteArray");
-
-  if (!vtable_index_result.has_value()) {
-    return std::unexpected(vtable_index_result.error());
-  }
-
   auto byte_array_obj_result =
-      data.memory_manager.AllocateObject(*byte_array_vtable, static_cast<uint32_t>(vtable_index_result.value()), data);
+      runtime::AllocateBuiltin<runtime::ByteArray>(data, runtime::BuiltinType::kByteArray, buffer.size());
 
   if (!byte_array_obj_result.has_value()) {
     return std::unexpected(byte_array_obj_result.error());
@@ -2097,7 +2343,6 @@ std::expected<ExecutionResult, std::runtime_error> FileRead(PassedExecutionData&
 
   void* byte_array_obj = byte_array_obj_result.value();
   auto* byte_array_data = runtime::GetDataPointer<runtime::ByteArray>(byte_array_obj);
-  new (byte_array_data) runtime::ByteArray(buffer.size());
   std::memcpy(byte_array_data->Data(), buffer.data(), buffer.size());
   data.memory.machine_stack.emplace(byte_array_obj);
 
@@ -2146,6 +2391,12 @@ std::expected<ExecutionResult, std::runtime_error> FileReadLine(PassedExecutionD
     return std::unexpected(std::runtime_error("File::ReadLine: file is not open"));
   }
 
+  std::expected<void, std::runtime_error> gc_res = bytecode::CollectGarbageBeforeRead(data, *file);
+
+  if (!gc_res.has_value()) {
+    return std::unexpected(gc_res.error());
+  }
+
   // Read line
   std::string line;
 
@@ -2154,31 +2405,14 @@ std::expected<ExecutionResult, std::runtime_error> FileReadLine(PassedExecutionD
     line = "";
   }
 
-  // Create String object
-  auto vtable_result = data.virtual_table_repository.GetByName("String");
-
-  if (!vtable_result.has_value()) {
-    return std::unexpected(std::runtime_error("File::ReadLine: String vtable not found"));
-  }
-
-  const runtime::VirtualTable* string_vtable = vtable_result.value();
-  auto vtable_index_result = data.virtual_table_repository.GetIndexByName("String");
-
-  if (!vtable_index_result.has_value()) {
-    return std::unexpected(vtable_index_result.error());
-  }
-
   auto string_obj_result =
-      data.memory_manager.AllocateObject(*string_vtable, static_cast<uint32_t>(vtable_index_result.value()), data);
+      runtime::AllocateBuiltin<runtime::String>(data, runtime::BuiltinType::kString, std::move(line));
 
   if (!string_obj_result.has_value()) {
     return std::unexpected(string_obj_result.error());
   }
 
-  void* string_obj = string_obj_result.value();
-  auto* string_data = runtime::GetDataPointer<std::string>(string_obj);
-  new (string_data) std::string(line);
-  data.memory.machine_stack.emplace(string_obj);
+  data.memory.machine_stack.emplace(string_obj_result.value());
   return ExecutionResult::kNormal;
 }
 
@@ -2193,14 +2427,14 @@ std::expected<ExecutionResult, std::runtime_error> FileWriteLine(PassedExecution
   void* line_obj = std::get<void*>(data.memory.stack_frames.top().local_variables[1]);
 
   auto* file = runtime::GetDataPointer<std::fstream>(obj_ptr);
-  auto* line = runtime::GetDataPointer<std::string>(line_obj);
+  const auto* line = runtime::GetDataPointer<const runtime::String>(line_obj);
 
   if (!file->is_open()) {
     return std::unexpected(std::runtime_error("File::WriteLine: file is not open"));
   }
 
   // Write line with newline
-  *file << *line << '\n';
+  *file << line->View() << '\n';
 
   if (file->fail()) {
     return std::unexpected(std::runtime_error("File::WriteLine: write failed"));
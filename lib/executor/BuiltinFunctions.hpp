@@ -1,12 +1,20 @@
 #ifndef EXECUTOR_BUILTINFUNCTIONS_HPP
 #define EXECUTOR_BUILTINFUNCTIONS_HPP
 
+#include <cstddef>
 #include <expected>
+#include <new>
 #include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "lib/execution_tree/ExecutionResult.hpp"
 #include "lib/execution_tree/PassedExecutionData.hpp"
+#include "lib/runtime/BuiltinTypes.hpp"
+#include "lib/runtime/ByteArray.hpp"
 #include "lib/runtime/ObjectDescriptor.hpp"
+#include "lib/runtime/String.hpp"
 
 namespace ovum::vm::runtime {
 
@@ -21,6 +29,62 @@ const T* GetDataPointer(const void* object_ptr) {
   return reinterpret_cast<const T*>(reinterpret_cast<const char*>(object_ptr) + sizeof(ObjectDescriptor));
 }
 
+// Size of the buffers a builtin payload owns outside the GC heap, reported through MemoryManager::ReportExternalMemory
+template<typename T>
+size_t ExternalBytes(const std::vector<T>& vec) {
+  return vec.capacity() * sizeof(T);
+}
+
+inline size_t ExternalBytes(const std::string& str) {
+  static const size_t kInlineCapacity = std::string().capacity();
+  return str.capacity() > kInlineCapacity ? str.capacity() + 1 : 0;
+}
+
+inline size_t ExternalBytes(const String& str) {
+  return str.BufferBytes();
+}
+
+inline size_t ExternalBytes(const ByteArray& byte_array) {
+  return byte_array.IsView() ? 0 : byte_array.Capacity();
+}
+
+// Allocates a builtin object through its recorded vtable index, constructs the payload in place and reports the
+// buffers it owns
+template<typename T, typename... Args>
+std::expected<void*, std::runtime_error> AllocateBuiltin(execution_tree::PassedExecutionData& data,
+                                                         BuiltinType type,
+                                                         Args&&... args) {
+  std::expected<uint32_t, std::runtime_error> vtable_index =
+      data.virtual_table_repository.GetBuiltinTypes().GetIndex(type);
+
+  if (!vtable_index.has_value()) {
+    return std::unexpected(vtable_index.error());
+  }
+
+  std::expected<const VirtualTable*, std::runtime_error> vtable =
+      std::as_const(data.virtual_table_repository).GetByIndex(vtable_index.value());
+
+  if (!vtable.has_value()) {
+    return std::unexpected(vtable.error());
+  }
+
+  std::expected<void*, std::runtime_error> obj =
+      data.memory_manager.AllocateObject(*vtable.value(), vtable_index.value(), data);
+
+  if (!obj.has_value()) {
+    return std::unexpected(obj.error());
+  }
+
+  T* payload = GetDataPointer<T>(obj.value());
+  new (payload) T(std::forward<Args>(args)...);
+
+  if constexpr (requires { ExternalBytes(*payload); }) {
+    data.memory_manager.ReportExternalMemory(obj.value(), ExternalBytes(*payload));
+  }
+
+  return obj.value();
+}
+
 } // namespace ovum::vm::runtime
 
 namespace ovum::vm::execution_tree {
@@ -84,6 +148,18 @@ std::expected<ExecutionResult, std::runtime_error> BoolGetHash(PassedExecutionDa
 std::expected<ExecutionResult, std::runtime_error> NullableConstructor(PassedExecutionData& data);
 std::expected<ExecutionResult, std::runtime_error> NullableDestructor(PassedExecutionData& data);
 
+// WeakRef methods
+std::expected<ExecutionResult, std::runtime_error> WeakRefConstructor(PassedExecutionData& data);
+std::expected<ExecutionResult, std::runtime_error> WeakRefDestructor(PassedExecutionData& data);
+std::expected<ExecutionResult, std::runtime_error> WeakRefGet(PassedExecutionData& data);
+std::expected<ExecutionResult, std::runtime_error> WeakRefIsAlive(PassedExecutionData& data);
+
+// SoftRef methods
+std::expected<ExecutionResult, std::runtime_error> SoftRefConstructor(PassedExecutionData& data);
+std::expected<ExecutionResult, std::runtime_error> SoftRefDestructor(PassedExecutionData& data);
+std::expected<ExecutionResult, std::runtime_error> SoftRefGet(PassedExecutionData& data);
+std::expected<ExecutionResult, std::runtime_error> SoftRefIsAlive(PassedExecutionData& data);
+
 // String methods
 std::expected<ExecutionResult, std::runtime_error> StringCopyConstructor(PassedExecutionData& data);
 std::expected<ExecutionResult, std::runtime_error> StringCopyAssignment(PassedExecutionData& data);
@@ -95,6 +171,18 @@ std::expected<ExecutionResult, std::runtime_error> StringGetHash(PassedExecution
 std::expected<ExecutionResult, std::runtime_error> StringLength(PassedExecutionData& data);
 std::expected<ExecutionResult, std::runtime_error> StringToUtf8Bytes(PassedExecutionData& data);
 
+// StringBuilder methods
+std::expected<ExecutionResult, std::runtime_error> StringBuilderConstructor(PassedExecutionData& data);
+std::expected<ExecutionResult, std::runtime_error> StringBuilderCopyConstructor(PassedExecutionData& data);
+std::expected<ExecutionResult, std::runtime_error> StringBuilderCopyAssignment(PassedExecutionData& data);
+std::expected<ExecutionResult, std::runtime_error> StringBuilderDestructor(PassedExecutionData& data);
+std::expected<ExecutionResult, std::runtime_error> StringBuilderToString(PassedExecutionData& data);
+std::expected<ExecutionResult, std::runtime_error> StringBuilderLength(PassedExecutionData& data);
+std::expected<ExecutionResult, std::runtime_error> StringBuilderAppend(PassedExecutionData& data);
+std::expected<ExecutionResult, std::runtime_error> StringBuilderAppendChar(PassedExecutionData& data);
+std::expected<ExecutionResult, std::runtime_error> StringBuilderClear(PassedExecutionData& data);
+std::expected<ExecutionResult, std::runtime_error> StringBuilderReserve(PassedExecutionData& data);
+
 // Array methods
 std::expected<ExecutionResult, std::runtime_error> IntArrayConstructor(PassedExecutionData& data);
 std::expected<ExecutionResult, std::runtime_error> IntArrayCopyConstructor(PassedExecutionData& data);
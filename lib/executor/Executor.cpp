@@ -7,6 +7,7 @@
 #include "lib/execution_tree/IFunctionExecutable.hpp"
 #include "lib/executor/BuiltinFunctions.hpp"
 #include "lib/runtime/StackFrame.hpp"
+#include "lib/runtime/String.hpp"
 #include "lib/runtime/Variable.hpp"
 #include "lib/runtime/VirtualTableRepository.hpp"
 
@@ -20,29 +21,14 @@ Executor::Executor(execution_tree::PassedExecutionData& execution_data) : execut
 namespace {
 std::expected<void*, std::runtime_error> CreateStringArrayFromArgs(execution_tree::PassedExecutionData& execution_data,
                                                                    const std::vector<std::string>& args) {
-  auto string_vtable_result = execution_data.virtual_table_repository.GetByName("String");
-  if (!string_vtable_result.has_value()) {
-    return std::unexpected(std::runtime_error("CreateStringArrayFromArgs: String vtable not found"));
-  }
-
-  const runtime::VirtualTable* string_vtable = string_vtable_result.value();
-  auto string_vtable_index_result = execution_data.virtual_table_repository.GetIndexByName("String");
-  if (!string_vtable_index_result.has_value()) {
-    return std::unexpected(string_vtable_index_result.error());
-  }
-
-  auto default_string_obj_result = execution_data.memory_manager.AllocateObject(
-      *string_vtable, static_cast<uint32_t>(string_vtable_index_result.value()), execution_data);
+  auto default_string_obj_result =
+      runtime::AllocateBuiltin<runtime::String>(execution_data, runtime::BuiltinType::kString);
 
   if (!default_string_obj_result.has_value()) {
     return std::unexpected(default_string_obj_result.error());
   }
 
-  void* default_string_obj = default_string_obj_result.value();
-  auto* default_string_data = runtime::GetDataPointer<std::string>(default_string_obj);
-  new (default_string_data) std::string();
-
-  execution_data.memory.machine_stack.emplace(default_string_obj);
+  execution_data.memory.machine_stack.emplace(default_string_obj_result.value());
   execution_data.memory.machine_stack.emplace(static_cast<int64_t>(args.size()));
 
   auto string_array_result = execution_tree::bytecode::CallConstructor(execution_data, "_StringArray_int_String");
@@ -67,29 +53,36 @@ std::expected<void*, std::runtime_error> CreateStringArrayFromArgs(execution_tre
     return std::unexpected(std::runtime_error("CreateStringArrayFromArgs: StringArray SetAt not found"));
   }
 
+  // SetAt calls are safepoints and the array is only referenced from here, so it is rooted and pinned until returned
+  execution_data.memory.temporary_roots.emplace_back(string_array_obj);
+  execution_data.memory_manager.Pin(string_array_obj);
+
   for (size_t i = 0; i < args.size(); ++i) {
-    auto string_obj_result = execution_data.memory_manager.AllocateObject(
-        *string_vtable, static_cast<uint32_t>(string_vtable_index_result.value()), execution_data);
+    auto string_obj_result =
+        runtime::AllocateBuiltin<runtime::String>(execution_data, runtime::BuiltinType::kString, args[i]);
 
     if (!string_obj_result.has_value()) {
+      execution_data.memory_manager.Unpin(string_array_obj);
+      execution_data.memory.temporary_roots.pop_back();
       return std::unexpected(string_obj_result.error());
     }
 
-    void* string_obj = string_obj_result.value();
-    auto* string_data = runtime::GetDataPointer<std::string>(string_obj);
-    new (string_data) std::string(args[i]);
-
-    execution_data.memory.machine_stack.emplace(string_obj);
+    execution_data.memory.machine_stack.emplace(string_obj_result.value());
     execution_data.memory.machine_stack.emplace(static_cast<int64_t>(i));
     execution_data.memory.machine_stack.emplace(string_array_obj);
 
     auto set_at_exec_result = set_at_result.value()->Execute(execution_data);
     if (!set_at_exec_result.has_value()) {
+      execution_data.memory_manager.Unpin(string_array_obj);
+      execution_data.memory.temporary_roots.pop_back();
       return std::unexpected(std::runtime_error("CreateStringArrayFromArgs: SetAt execution failed: " +
                                                 std::string(set_at_exec_result.error().what())));
     }
   }
 
+  execution_data.memory_manager.Unpin(string_array_obj);
+  execution_data.memory.temporary_roots.pop_back();
+
   return string_array_obj;
 }
 } // namespace
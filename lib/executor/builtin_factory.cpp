@@ -18,9 +18,11 @@
 #include "lib/runtime/ByteArray.hpp"
 #include "lib/runtime/FunctionId.hpp"
 #include "lib/runtime/ObjectDescriptor.hpp"
+#include "lib/runtime/String.hpp"
 #include "lib/runtime/VirtualTable.hpp"
 #include "lib/runtime/VirtualTableRepository.hpp"
 #include "lib/runtime/gc/reference_scanners/ArrayReferenceScanner.hpp"
+#include "lib/runtime/gc/reference_scanners/WeakReferenceScanner.hpp"
 
 namespace ovum::vm::runtime {
 
@@ -39,6 +41,7 @@ std::expected<void, std::runtime_error> RegisterBuiltinVirtualTables(VirtualTabl
     VirtualTable int_vtable("Int", sizeof(ObjectDescriptor) + sizeof(int64_t));
     int_vtable.AddField("int", sizeof(ObjectDescriptor));
     int_vtable.AddFunction("_destructor_<M>", "_Int_destructor_<M>");
+    int_vtable.SetTriviallyDestructible(true);
     int_vtable.AddFunction("_Equals_<C>_Object", "_Int_Equals_<C>_Object");
     int_vtable.AddFunction("_IsLess_<C>_Object", "_Int_IsLess_<C>_Object");
     int_vtable.AddFunction("_ToString_<C>", "_Int_ToString_<C>");
@@ -57,6 +60,7 @@ std::expected<void, std::runtime_error> RegisterBuiltinVirtualTables(VirtualTabl
     VirtualTable float_vtable("Float", sizeof(ObjectDescriptor) + sizeof(double));
     float_vtable.AddField("float", sizeof(ObjectDescriptor));
     float_vtable.AddFunction("_destructor_<M>", "_Float_destructor_<M>");
+    float_vtable.SetTriviallyDestructible(true);
     float_vtable.AddFunction("_Equals_<C>_Object", "_Float_Equals_<C>_Object");
     float_vtable.AddFunction("_IsLess_<C>_Object", "_Float_IsLess_<C>_Object");
     float_vtable.AddFunction("_ToString_<C>", "_Float_ToString_<C>");
@@ -75,6 +79,7 @@ std::expected<void, std::runtime_error> RegisterBuiltinVirtualTables(VirtualTabl
     VirtualTable char_vtable("Char", sizeof(ObjectDescriptor) + sizeof(char));
     char_vtable.AddField("char", sizeof(ObjectDescriptor));
     char_vtable.AddFunction("_destructor_<M>", "_Char_destructor_<M>");
+    char_vtable.SetTriviallyDestructible(true);
     char_vtable.AddFunction("_Equals_<C>_Object", "_Char_Equals_<C>_Object");
     char_vtable.AddFunction("_IsLess_<C>_Object", "_Char_IsLess_<C>_Object");
     char_vtable.AddFunction("_ToString_<C>", "_Char_ToString_<C>");
@@ -93,6 +98,7 @@ std::expected<void, std::runtime_error> RegisterBuiltinVirtualTables(VirtualTabl
     VirtualTable byte_vtable("Byte", sizeof(ObjectDescriptor) + sizeof(uint8_t));
     byte_vtable.AddField("byte", sizeof(ObjectDescriptor));
     byte_vtable.AddFunction("_destructor_<M>", "_Byte_destructor_<M>");
+    byte_vtable.SetTriviallyDestructible(true);
     byte_vtable.AddFunction("_Equals_<C>_Object", "_Byte_Equals_<C>_Object");
     byte_vtable.AddFunction("_IsLess_<C>_Object", "_Byte_IsLess_<C>_Object");
     byte_vtable.AddFunction("_ToString_<C>", "_Byte_ToString_<C>");
@@ -111,6 +117,7 @@ std::expected<void, std::runtime_error> RegisterBuiltinVirtualTables(VirtualTabl
     VirtualTable bool_vtable("Bool", sizeof(ObjectDescriptor) + sizeof(bool));
     bool_vtable.AddField("bool", sizeof(ObjectDescriptor));
     bool_vtable.AddFunction("_destructor_<M>", "_Bool_destructor_<M>");
+    bool_vtable.SetTriviallyDestructible(true);
     bool_vtable.AddFunction("_Equals_<C>_Object", "_Bool_Equals_<C>_Object");
     bool_vtable.AddFunction("_IsLess_<C>_Object", "_Bool_IsLess_<C>_Object");
     bool_vtable.AddFunction("_ToString_<C>", "_Bool_ToString_<C>");
@@ -129,16 +136,49 @@ std::expected<void, std::runtime_error> RegisterBuiltinVirtualTables(VirtualTabl
     VirtualTable nullable_vtable("Nullable", sizeof(ObjectDescriptor) + sizeof(void*));
     nullable_vtable.AddField("Object", sizeof(ObjectDescriptor));
     nullable_vtable.AddFunction("_destructor_<M>", "_Nullable_destructor_<M>");
+    nullable_vtable.SetTriviallyDestructible(true);
     auto result = repository.Add(std::move(nullable_vtable));
     if (!result.has_value()) {
       return std::unexpected(result.error());
     }
   }
 
+  // WeakRef: referent that does not keep its object alive
+  {
+    VirtualTable weak_ref_vtable(
+        "WeakRef", sizeof(ObjectDescriptor) + sizeof(void*), std::make_unique<WeakReferenceScanner>());
+    weak_ref_vtable.AddFunction("_destructor_<M>", "_WeakRef_destructor_<M>");
+    weak_ref_vtable.SetTriviallyDestructible(true);
+    weak_ref_vtable.SetReferenceStrength(ReferenceStrength::kWeak);
+    weak_ref_vtable.AddFunction("_Get_<C>", "_WeakRef_Get_<C>");
+    weak_ref_vtable.AddFunction("_IsAlive_<C>", "_WeakRef_IsAlive_<C>");
+    auto result = repository.Add(std::move(weak_ref_vtable));
+    if (!result.has_value()) {
+      return std::unexpected(result.error());
+    }
+  }
+
+  // SoftRef: referent kept alive until the heap nears its limit
+  {
+    VirtualTable soft_ref_vtable(
+        "SoftRef", sizeof(ObjectDescriptor) + sizeof(void*), std::make_unique<WeakReferenceScanner>());
+    soft_ref_vtable.AddFunction("_destructor_<M>", "_SoftRef_destructor_<M>");
+    soft_ref_vtable.SetTriviallyDestructible(true);
+    soft_ref_vtable.SetReferenceStrength(ReferenceStrength::kSoft);
+    soft_ref_vtable.AddFunction("_Get_<C>", "_SoftRef_Get_<C>");
+    soft_ref_vtable.AddFunction("_IsAlive_<C>", "_SoftRef_IsAlive_<C>");
+    auto result = repository.Add(std::move(soft_ref_vtable));
+    if (!result.has_value()) {
+      return std::unexpected(result.error());
+    }
+  }
+
   // String: wrapper around std::string
   {
-    VirtualTable string_vtable("String", sizeof(ObjectDescriptor) + sizeof(std::string));
+    // The payload only holds a pointer to its shared buffer, so unlike std::string it can be moved bytewise
+    VirtualTable string_vtable("String", sizeof(ObjectDescriptor) + sizeof(String));
     string_vtable.AddFunction("_destructor_<M>", "_String_destructor_<M>");
+    string_vtable.SetHeapOnly(true);
     string_vtable.AddFunction("_Equals_<C>_Object", "_String_Equals_<C>_Object");
     string_vtable.AddFunction("_IsLess_<C>_Object", "_String_IsLess_<C>_Object");
     string_vtable.AddFunction("_ToString_<C>", "_String_ToString_<C>");
@@ -154,9 +194,30 @@ std::expected<void, std::runtime_error> RegisterBuiltinVirtualTables(VirtualTabl
     }
   }
 
+  // StringBuilder: mutable std::string for building text with amortized appends
+  {
+    VirtualTable string_builder_vtable("StringBuilder", sizeof(ObjectDescriptor) + sizeof(std::string));
+    // std::string may point into its own object (small string buffer), so it cannot be moved bytewise
+    string_builder_vtable.SetRelocatable(false);
+    string_builder_vtable.AddFunction("_destructor_<M>", "_StringBuilder_destructor_<M>");
+    string_builder_vtable.SetHeapOnly(true);
+    string_builder_vtable.AddFunction("_ToString_<C>", "_StringBuilder_ToString_<C>");
+    string_builder_vtable.AddFunction("_Length_<C>", "_StringBuilder_Length_<C>");
+    string_builder_vtable.AddFunction("_Append_<M>_String", "_StringBuilder_Append_<M>_String");
+    string_builder_vtable.AddFunction("_AppendChar_<M>_char", "_StringBuilder_AppendChar_<M>_char");
+    string_builder_vtable.AddFunction("_Clear_<M>", "_StringBuilder_Clear_<M>");
+    string_builder_vtable.AddFunction("_Reserve_<M>_int", "_StringBuilder_Reserve_<M>_int");
+    string_builder_vtable.AddInterface("IStringConvertible");
+    auto result = repository.Add(std::move(string_builder_vtable));
+    if (!result.has_value()) {
+      return std::unexpected(result.error());
+    }
+  }
+
   // File: wrapper around std::fstream
   {
     VirtualTable file_vtable("File", sizeof(ObjectDescriptor) + sizeof(std::fstream));
+    file_vtable.SetRelocatable(false);
     file_vtable.AddFunction("_destructor_<M>", "_File_destructor_<M>");
     file_vtable.AddFunction("_Open_<M>_String_String", "_File_Open_<M>_String_String");
     file_vtable.AddFunction("_Close_<M>", "_File_Close_<M>");
@@ -179,6 +240,7 @@ std::expected<void, std::runtime_error> RegisterBuiltinVirtualTables(VirtualTabl
   {
     VirtualTable int_array_vtable("IntArray", sizeof(ObjectDescriptor) + sizeof(std::vector<int64_t>));
     int_array_vtable.AddFunction("_destructor_<M>", "_IntArray_destructor_<M>");
+    int_array_vtable.SetHeapOnly(true);
     int_array_vtable.AddFunction("_Equals_<C>_Object", "_IntArray_Equals_<C>_Object");
     int_array_vtable.AddFunction("_IsLess_<C>_Object", "_IntArray_IsLess_<C>_Object");
     int_array_vtable.AddFunction("_GetHash_<C>", "_IntArray_GetHash_<C>");
@@ -194,6 +256,7 @@ std::expected<void, std::runtime_error> RegisterBuiltinVirtualTables(VirtualTabl
   {
     VirtualTable float_array_vtable("FloatArray", sizeof(ObjectDescriptor) + sizeof(std::vector<double>));
     float_array_vtable.AddFunction("_destructor_<M>", "_FloatArray_destructor_<M>");
+    float_array_vtable.SetHeapOnly(true);
     float_array_vtable.AddFunction("_Equals_<C>_Object", "_FloatArray_Equals_<C>_Object");
     float_array_vtable.AddFunction("_IsLess_<C>_Object", "_FloatArray_IsLess_<C>_Object");
     float_array_vtable.AddFunction("_GetHash_<C>", "_FloatArray_GetHash_<C>");
@@ -209,6 +272,7 @@ std::expected<void, std::runtime_error> RegisterBuiltinVirtualTables(VirtualTabl
   {
     VirtualTable char_array_vtable("CharArray", sizeof(ObjectDescriptor) + sizeof(std::vector<char>));
     char_array_vtable.AddFunction("_destructor_<M>", "_CharArray_destructor_<M>");
+    char_array_vtable.SetHeapOnly(true);
     char_array_vtable.AddFunction("_Equals_<C>_Object", "_CharArray_Equals_<C>_Object");
     char_array_vtable.AddFunction("_IsLess_<C>_Object", "_CharArray_IsLess_<C>_Object");
     char_array_vtable.AddFunction("_GetHash_<C>", "_CharArray_GetHash_<C>");
@@ -225,6 +289,7 @@ std::expected<void, std::runtime_error> RegisterBuiltinVirtualTables(VirtualTabl
   {
     VirtualTable byte_array_vtable("ByteArray", sizeof(ObjectDescriptor) + sizeof(ovum::vm::runtime::ByteArray));
     byte_array_vtable.AddFunction("_destructor_<M>", "_ByteArray_destructor_<M>");
+    byte_array_vtable.SetHeapOnly(true);
     byte_array_vtable.AddFunction("_Equals_<C>_Object", "_ByteArray_Equals_<C>_Object");
     byte_array_vtable.AddFunction("_IsLess_<C>_Object", "_ByteArray_IsLess_<C>_Object");
     byte_array_vtable.AddFunction("_GetHash_<C>", "_ByteArray_GetHash_<C>");
@@ -240,6 +305,7 @@ std::expected<void, std::runtime_error> RegisterBuiltinVirtualTables(VirtualTabl
   {
     VirtualTable bool_array_vtable("BoolArray", sizeof(ObjectDescriptor) + sizeof(std::vector<bool>));
     bool_array_vtable.AddFunction("_destructor_<M>", "_BoolArray_destructor_<M>");
+    bool_array_vtable.SetHeapOnly(true);
     bool_array_vtable.AddFunction("_Equals_<C>_Object", "_BoolArray_Equals_<C>_Object");
     bool_array_vtable.AddFunction("_IsLess_<C>_Object", "_BoolArray_IsLess_<C>_Object");
     bool_array_vtable.AddFunction("_GetHash_<C>", "_BoolArray_GetHash_<C>");
@@ -257,6 +323,7 @@ std::expected<void, std::runtime_error> RegisterBuiltinVirtualTables(VirtualTabl
                                      sizeof(ObjectDescriptor) + sizeof(std::vector<void*>),
                                      std::make_unique<ArrayReferenceScanner>());
     object_array_vtable.AddFunction("_destructor_<M>", "_ObjectArray_destructor_<M>");
+    object_array_vtable.SetHeapOnly(true);
     object_array_vtable.AddFunction("_Equals_<C>_Object", "_ObjectArray_Equals_<C>_Object");
     object_array_vtable.AddFunction("_IsLess_<C>_Object", "_ObjectArray_IsLess_<C>_Object");
     object_array_vtable.AddFunction("_GetHash_<C>", "_ObjectArray_GetHash_<C>");
@@ -274,6 +341,7 @@ std::expected<void, std::runtime_error> RegisterBuiltinVirtualTables(VirtualTabl
                                      sizeof(ObjectDescriptor) + sizeof(std::vector<void*>),
                                      std::make_unique<ArrayReferenceScanner>());
     string_array_vtable.AddFunction("_destructor_<M>", "_StringArray_destructor_<M>");
+    string_array_vtable.SetHeapOnly(true);
     string_array_vtable.AddFunction("_Equals_<C>_Object", "_StringArray_Equals_<C>_Object");
     string_array_vtable.AddFunction("_IsLess_<C>_Object", "_StringArray_IsLess_<C>_Object");
     string_array_vtable.AddFunction("_GetHash_<C>", "_StringArray_GetHash_<C>");
@@ -290,6 +358,7 @@ std::expected<void, std::runtime_error> RegisterBuiltinVirtualTables(VirtualTabl
     VirtualTable pointer_vtable("Pointer", sizeof(ObjectDescriptor) + sizeof(void*));
     pointer_vtable.AddField("Object", sizeof(ObjectDescriptor));
     pointer_vtable.AddFunction("_destructor_<M>", "_Pointer_destructor_<M>");
+    pointer_vtable.SetTriviallyDestructible(true);
     pointer_vtable.AddFunction("_Equals_<C>_Object", "_Pointer_Equals_<C>_Object");
     pointer_vtable.AddFunction("_IsLess_<C>_Object", "_Pointer_IsLess_<C>_Object");
     pointer_vtable.AddFunction("_GetHash_<C>", "_Pointer_GetHash_<C>");
@@ -307,6 +376,7 @@ std::expected<void, std::runtime_error> RegisterBuiltinVirtualTables(VirtualTabl
                                       sizeof(ObjectDescriptor) + sizeof(std::vector<void*>),
                                       std::make_unique<ArrayReferenceScanner>());
     pointer_array_vtable.AddFunction("_destructor_<M>", "_PointerArray_destructor_<M>");
+    pointer_array_vtable.SetHeapOnly(true);
     pointer_array_vtable.AddFunction("_Equals_<C>_Object", "_PointerArray_Equals_<C>_Object");
     pointer_array_vtable.AddFunction("_IsLess_<C>_Object", "_PointerArray_IsLess_<C>_Object");
     pointer_array_vtable.AddFunction("_GetHash_<C>", "_PointerArray_GetHash_<C>");
@@ -711,6 +781,72 @@ std::expected<void, std::runtime_error> RegisterBuiltinFunctions(FunctionReposit
     }
   }
 
+  // WeakRef methods
+  {
+    auto function = CreateMethodFunction("_WeakRef_Object", 2, WeakRefConstructor);
+    auto result = repository.Add(std::move(function));
+    if (!result.has_value()) {
+      return std::unexpected(result.error());
+    }
+  }
+
+  {
+    auto function = CreateMethodFunction("_WeakRef_destructor_<M>", 1, WeakRefDestructor);
+    auto result = repository.Add(std::move(function));
+    if (!result.has_value()) {
+      return std::unexpected(result.error());
+    }
+  }
+
+  {
+    auto function = CreateMethodFunction("_WeakRef_Get_<C>", 1, WeakRefGet);
+    auto result = repository.Add(std::move(function));
+    if (!result.has_value()) {
+      return std::unexpected(result.error());
+    }
+  }
+
+  {
+    auto function = CreateMethodFunction("_WeakRef_IsAlive_<C>", 1, WeakRefIsAlive);
+    auto result = repository.Add(std::move(function));
+    if (!result.has_value()) {
+      return std::unexpected(result.error());
+    }
+  }
+
+  // SoftRef methods
+  {
+    auto function = CreateMethodFunction("_SoftRef_Object", 2, SoftRefConstructor);
+    auto result = repository.Add(std::move(function));
+    if (!result.has_value()) {
+      return std::unexpected(result.error());
+    }
+  }
+
+  {
+    auto function = CreateMethodFunction("_SoftRef_destructor_<M>", 1, SoftRefDestructor);
+    auto result = repository.Add(std::move(function));
+    if (!result.has_value()) {
+      return std::unexpected(result.error());
+    }
+  }
+
+  {
+    auto function = CreateMethodFunction("_SoftRef_Get_<C>", 1, SoftRefGet);
+    auto result = repository.Add(std::move(function));
+    if (!result.has_value()) {
+      return std::unexpected(result.error());
+    }
+  }
+
+  {
+    auto function = CreateMethodFunction("_SoftRef_IsAlive_<C>", 1, SoftRefIsAlive);
+    auto result = repository.Add(std::move(function));
+    if (!result.has_value()) {
+      return std::unexpected(result.error());
+    }
+  }
+
   // String methods
   {
     auto function = CreateMethodFunction("_String_String", 2, StringCopyConstructor);
@@ -2043,6 +2179,87 @@ std::expected<void, std::runtime_error> RegisterBuiltinFunctions(FunctionReposit
     }
   }
 
+  // StringBuilder methods
+  {
+    auto function = CreateMethodFunction("_StringBuilder", 1, StringBuilderConstructor);
+    auto result = repository.Add(std::move(function));
+    if (!result.has_value()) {
+      return std::unexpected(result.error());
+    }
+  }
+
+  {
+    auto function = CreateMethodFunction("_StringBuilder_StringBuilder", 2, StringBuilderCopyConstructor);
+    auto result = repository.Add(std::move(function));
+    if (!result.has_value()) {
+      return std::unexpected(result.error());
+    }
+  }
+
+  {
+    auto function = CreateMethodFunction("_StringBuilder_copy_<M>_StringBuilder", 2, StringBuilderCopyAssignment);
+    auto result = repository.Add(std::move(function));
+    if (!result.has_value()) {
+      return std::unexpected(result.error());
+    }
+  }
+
+  {
+    auto function = CreateMethodFunction("_StringBuilder_destructor_<M>", 1, StringBuilderDestructor);
+    auto result = repository.Add(std::move(function));
+    if (!result.has_value()) {
+      return std::unexpected(result.error());
+    }
+  }
+
+  {
+    auto function = CreateMethodFunction("_StringBuilder_ToString_<C>", 1, StringBuilderToString);
+    auto result = repository.Add(std::move(function));
+    if (!result.has_value()) {
+      return std::unexpected(result.error());
+    }
+  }
+
+  {
+    auto function = CreateMethodFunction("_StringBuilder_Length_<C>", 1, StringBuilderLength);
+    auto result = repository.Add(std::move(function));
+    if (!result.has_value()) {
+      return std::unexpected(result.error());
+    }
+  }
+
+  {
+    auto function = CreateMethodFunction("_StringBuilder_Append_<M>_String", 2, StringBuilderAppend);
+    auto result = repository.Add(std::move(function));
+    if (!result.has_value()) {
+      return std::unexpected(result.error());
+    }
+  }
+
+  {
+    auto function = CreateMethodFunction("_StringBuilder_AppendChar_<M>_char", 2, StringBuilderAppendChar);
+    auto result = repository.Add(std::move(function));
+    if (!result.has_value()) {
+      return std::unexpected(result.error());
+    }
+  }
+
+  {
+    auto function = CreateMethodFunction("_StringBuilder_Clear_<M>", 1, StringBuilderClear);
+    auto result = repository.Add(std::move(function));
+    if (!result.has_value()) {
+      return std::unexpected(result.error());
+    }
+  }
+
+  {
+    auto function = CreateMethodFunction("_StringBuilder_Reserve_<M>_int", 2, StringBuilderReserve);
+    auto result = repository.Add(std::move(function));
+    if (!result.has_value()) {
+      return std::unexpected(result.error());
+    }
+  }
+
   return {};
 }
 
@@ -0,0 +1,125 @@
+#include "BoxCache.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <variant>
+
+#include "lib/runtime/gc/IGarbageCollector.hpp"
+
+#include "ObjectDescriptor.hpp"
+
+namespace ovum::vm::runtime {
+
+namespace {
+
+constexpr size_t kBoxAlignment = alignof(std::max_align_t);
+constexpr size_t kByteValueCount = static_cast<size_t>(std::numeric_limits<uint8_t>::max()) + 1;
+
+} // namespace
+
+BoxCache::BoxCache(int64_t small_int_min, int64_t small_int_max) :
+    small_int_min_(small_int_min), small_int_max_(small_int_max) {
+}
+
+std::expected<void*, std::runtime_error> BoxCache::GetBox(const Variable& value,
+                                                          const VirtualTableRepository& vtables) {
+  if (std::holds_alternative<int64_t>(value)) {
+    const int64_t int_value = std::get<int64_t>(value);
+
+    if (int_value < small_int_min_ || int_value > small_int_max_) {
+      return nullptr;
+    }
+
+    const auto count = static_cast<size_t>(small_int_max_ - small_int_min_) + 1;
+    const auto slot = static_cast<size_t>(int_value - small_int_min_);
+
+    return GetFromTable<int64_t>(int_boxes_, "Int", small_int_min_, count, slot, vtables);
+  }
+
+  if (std::holds_alternative<bool>(value)) {
+    const size_t slot = std::get<bool>(value) ? 1 : 0;
+
+    return GetFromTable<bool>(bool_boxes_, "Bool", 0, 2, slot, vtables);
+  }
+
+  if (std::holds_alternative<char>(value)) {
+    const size_t slot = static_cast<uint8_t>(std::get<char>(value));
+
+    return GetFromTable<char>(char_boxes_, "Char", 0, kByteValueCount, slot, vtables);
+  }
+
+  if (std::holds_alternative<uint8_t>(value)) {
+    const size_t slot = std::get<uint8_t>(value);
+
+    return GetFromTable<uint8_t>(byte_boxes_, "Byte", 0, kByteValueCount, slot, vtables);
+  }
+
+  return nullptr;
+}
+
+std::expected<void*, std::runtime_error> BoxCache::GetNullBox(const VirtualTableRepository& vtables) {
+  return GetFromTable<void*>(null_box_, "Nullable", 0, 1, 0, vtables);
+}
+
+void BoxCache::SetSmallIntRange(int64_t small_int_min, int64_t small_int_max) {
+  small_int_min_ = small_int_min;
+  small_int_max_ = small_int_max;
+  int_boxes_ = {};
+}
+
+void BoxCache::Reset() {
+  int_boxes_ = {};
+  bool_boxes_ = {};
+  char_boxes_ = {};
+  byte_boxes_ = {};
+  null_box_ = {};
+}
+
+bool BoxCache::IsImmortal(const void* obj) {
+  return (static_cast<const ObjectDescriptor*>(obj)->badge & kImmortalBit) != 0;
+}
+
+template<typename T>
+std::expected<void*, std::runtime_error> BoxCache::GetFromTable(BoxTable& table,
+                                                                const std::string& class_name,
+                                                                int64_t first_value,
+                                                                size_t count,
+                                                                size_t slot,
+                                                                const VirtualTableRepository& vtables) {
+  if (!table.storage) {
+    auto vtable_index = vtables.GetIndexByName(class_name);
+
+    if (!vtable_index.has_value()) {
+      return std::unexpected(vtable_index.error());
+    }
+
+    auto vtable = vtables.GetByIndex(vtable_index.value());
+
+    if (!vtable.has_value()) {
+      return std::unexpected(vtable.error());
+    }
+
+    const size_t stride = (vtable.value()->GetSize() + kBoxAlignment - 1) / kBoxAlignment * kBoxAlignment;
+    table.storage = std::make_unique<char[]>(stride * count);
+    table.stride = stride;
+
+    for (size_t i = 0; i < count; ++i) {
+      char* raw = table.storage.get() + i * stride;
+      auto* descriptor = reinterpret_cast<ObjectDescriptor*>(raw);
+      descriptor->vtable_index = static_cast<uint32_t>(vtable_index.value());
+      descriptor->badge = kMarkBit | kImmortalBit;
+      auto* payload = reinterpret_cast<T*>(raw + sizeof(ObjectDescriptor));
+
+      if constexpr (std::is_pointer_v<T>) {
+        *payload = nullptr;
+      } else {
+        *payload = static_cast<T>(first_value + static_cast<int64_t>(i));
+      }
+    }
+  }
+
+  return table.storage.get() + slot * table.stride;
+}
+
+} // namespace ovum::vm::runtime
@@ -0,0 +1,61 @@
+#ifndef RUNTIME_BOXCACHE_HPP
+#define RUNTIME_BOXCACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "Variable.hpp"
+#include "VirtualTableRepository.hpp"
+
+namespace ovum::vm::runtime {
+
+// Preallocated Bool, Char and Byte boxes for every value, Int boxes for a small range and the null Nullable. The boxes
+// live outside the object repository and are permanently marked, so collectors neither trace nor free them. Boxes are
+// shared, so code handing them out must not let the program assign into them.
+class BoxCache {
+public:
+  static constexpr int64_t kDefaultSmallIntMin = -128;
+  static constexpr int64_t kDefaultSmallIntMax = 1023;
+
+  explicit BoxCache(int64_t small_int_min = kDefaultSmallIntMin, int64_t small_int_max = kDefaultSmallIntMax);
+
+  // Returns nullptr when the value has no cached box
+  std::expected<void*, std::runtime_error> GetBox(const Variable& value, const VirtualTableRepository& vtables);
+  std::expected<void*, std::runtime_error> GetNullBox(const VirtualTableRepository& vtables);
+
+  // Int boxes outside the new range are dropped; boxes already handed out must no longer be referenced
+  void SetSmallIntRange(int64_t small_int_min, int64_t small_int_max);
+  void Reset();
+
+  [[nodiscard]] static bool IsImmortal(const void* obj);
+
+private:
+  struct BoxTable {
+    std::unique_ptr<char[]> storage;
+    size_t stride = 0;
+  };
+
+  template<typename T>
+  static std::expected<void*, std::runtime_error> GetFromTable(BoxTable& table,
+                                                               const std::string& class_name,
+                                                               int64_t first_value,
+                                                               size_t count,
+                                                               size_t slot,
+                                                               const VirtualTableRepository& vtables);
+
+  int64_t small_int_min_;
+  int64_t small_int_max_;
+  BoxTable int_boxes_;
+  BoxTable bool_boxes_;
+  BoxTable char_boxes_;
+  BoxTable byte_boxes_;
+  BoxTable null_box_;
+};
+
+} // namespace ovum::vm::runtime
+
+#endif // RUNTIME_BOXCACHE_HPP
@@ -0,0 +1,71 @@
+#include "BuiltinTypes.hpp"
+
+#include <unordered_map>
+
+namespace ovum::vm::runtime {
+
+namespace {
+
+const std::array<std::string, static_cast<size_t>(BuiltinType::kCount)> kBuiltinTypeNames = {
+    "Int",
+    "Float",
+    "Char",
+    "Byte",
+    "Bool",
+    "Nullable",
+    "String",
+    "File",
+    "ByteArray",
+    "IntArray",
+    "FloatArray",
+    "CharArray",
+    "BoolArray",
+    "ObjectArray",
+    "StringArray",
+    "PointerArray",
+};
+
+const std::unordered_map<std::string, BuiltinType>& GetTypesByName() {
+  static const std::unordered_map<std::string, BuiltinType> kMap = [] {
+    std::unordered_map<std::string, BuiltinType> map;
+
+    for (size_t i = 0; i < kBuiltinTypeNames.size(); ++i) {
+      map.emplace(kBuiltinTypeNames[i], static_cast<BuiltinType>(i));
+    }
+
+    return map;
+  }();
+
+  return kMap;
+}
+
+} // namespace
+
+BuiltinTypes::BuiltinTypes() {
+  indices_.fill(kUnregistered);
+}
+
+void BuiltinTypes::Record(const std::string& class_name, size_t vtable_index) {
+  const auto& types_by_name = GetTypesByName();
+  auto it = types_by_name.find(class_name);
+
+  if (it != types_by_name.end()) {
+    indices_[static_cast<size_t>(it->second)] = static_cast<uint32_t>(vtable_index);
+  }
+}
+
+std::expected<uint32_t, std::runtime_error> BuiltinTypes::GetIndex(BuiltinType type) const {
+  const uint32_t index = indices_[static_cast<size_t>(type)];
+
+  if (index == kUnregistered) {
+    return std::unexpected(std::runtime_error("Builtin class " + GetName(type) + " is not registered"));
+  }
+
+  return index;
+}
+
+const std::string& BuiltinTypes::GetName(BuiltinType type) {
+  return kBuiltinTypeNames[static_cast<size_t>(type)];
+}
+
+} // namespace ovum::vm::runtime
@@ -0,0 +1,52 @@
+#ifndef RUNTIME_BUILTINTYPES_HPP
+#define RUNTIME_BUILTINTYPES_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <stdexcept>
+#include <string>
+
+namespace ovum::vm::runtime {
+
+enum class BuiltinType : uint8_t {
+  kInt,
+  kFloat,
+  kChar,
+  kByte,
+  kBool,
+  kNullable,
+  kString,
+  kFile,
+  kByteArray,
+  kIntArray,
+  kFloatArray,
+  kCharArray,
+  kBoolArray,
+  kObjectArray,
+  kStringArray,
+  kPointerArray,
+  kCount,
+};
+
+// Vtable indices of the builtin classes the VM allocates itself. Indices are recorded as the classes are registered,
+// so builtins allocate without hashing class names.
+class BuiltinTypes {
+public:
+  BuiltinTypes();
+
+  void Record(const std::string& class_name, size_t vtable_index);
+  [[nodiscard]] std::expected<uint32_t, std::runtime_error> GetIndex(BuiltinType type) const;
+
+  [[nodiscard]] static const std::string& GetName(BuiltinType type);
+
+private:
+  static constexpr uint32_t kUnregistered = UINT32_MAX;
+
+  std::array<uint32_t, static_cast<size_t>(BuiltinType::kCount)> indices_;
+};
+
+} // namespace ovum::vm::runtime
+
+#endif // RUNTIME_BUILTINTYPES_HPP
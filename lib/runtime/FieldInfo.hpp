@@ -1,18 +1,45 @@
 #ifndef RUNTIME_FIELDINFO_HPP
 #define RUNTIME_FIELDINFO_HPP
 
+#include <cstddef>
 #include <cstdint>
-#include <memory>
-
-#include "IVariableAccessor.hpp"
 
 namespace ovum::vm::runtime {
 
+enum class FieldType : uint8_t {
+  kInt,
+  kFloat,
+  kBool,
+  kChar,
+  kByte,
+  kObject,
+};
+
 struct FieldInfo {
   int64_t offset;
-  std::shared_ptr<IVariableAccessor> variable_accessor;
+  FieldType type;
 };
 
+// Fields are stored unboxed and aligned to their own size
+constexpr size_t GetFieldSize(FieldType type) {
+  switch (type) {
+    case FieldType::kInt:
+      return sizeof(int64_t);
+    case FieldType::kFloat:
+      return sizeof(double);
+    case FieldType::kBool:
+      return sizeof(bool);
+    case FieldType::kChar:
+      return sizeof(char);
+    case FieldType::kByte:
+      return sizeof(uint8_t);
+    case FieldType::kObject:
+      break;
+  }
+
+  return sizeof(void*);
+}
+
 } // namespace ovum::vm::runtime
 
 #endif // RUNTIME_FIELDINFO_HPP
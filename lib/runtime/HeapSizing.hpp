@@ -0,0 +1,25 @@
+#ifndef RUNTIME_HEAPSIZING_HPP
+#define RUNTIME_HEAPSIZING_HPP
+
+#include <cstddef>
+
+namespace ovum::vm::runtime {
+
+// A collection starts once allocated bytes exceed the heap target. After every finished cycle the target is reset
+// to the surviving bytes scaled by growth_factor, but never below initial_heap_bytes or above max_heap_bytes.
+// At idle points, such as sleeps and blocking reads, a collection starts early once the heap passes
+// idle_collection_fraction of the target.
+struct HeapSizing {
+  static constexpr size_t kDefaultInitialHeapBytes = 4 * 1024 * 1024;
+  static constexpr double kDefaultGrowthFactor = 2.0;
+  static constexpr double kDefaultIdleCollectionFraction = 0.5;
+
+  size_t initial_heap_bytes = kDefaultInitialHeapBytes;
+  double growth_factor = kDefaultGrowthFactor;
+  size_t max_heap_bytes = 0; // 0 means unlimited
+  double idle_collection_fraction = kDefaultIdleCollectionFraction;
+};
+
+} // namespace ovum::vm::runtime
+
+#endif // RUNTIME_HEAPSIZING_HPP
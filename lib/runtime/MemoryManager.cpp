@@ -1,5 +1,7 @@
 #include "MemoryManager.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <cstring>
 #include <optional>
 #include <utility>
@@ -12,22 +14,71 @@
 
 namespace ovum::vm::runtime {
 
-MemoryManager::MemoryManager(std::unique_ptr<IGarbageCollector> gc, size_t max_objects) :
-    gc_(std::move(gc)), gc_threshold_(max_objects), gc_in_progress_(false) {
+namespace {
+
+// With a hard heap limit, collections start this fraction of the limit early so that the allocations made between
+// two safepoints still fit
+constexpr size_t kMaxHeapHeadroomDivisor = 8;
+
+// Smaller batches of trivially destructible garbage are freed in place; waking the worker would cost more
+constexpr size_t kMinBackgroundFreeBatch = 256;
+
+} // namespace
+
+MemoryManager::MemoryManager(std::unique_ptr<IGarbageCollector> gc, HeapSizing sizing) :
+    gc_(std::move(gc)), sizing_(sizing), allocated_bytes_(0), external_bytes_(0), heap_target_(0),
+    last_collection_pause_(0), gc_in_progress_(false), write_barrier_active_(false) {
+  UpdateHeapTarget();
 }
 
 std::expected<void*, std::runtime_error> MemoryManager::AllocateObject(const VirtualTable& vtable,
                                                                        uint32_t vtable_index,
                                                                        execution_tree::PassedExecutionData& data) {
+  if (gc_ && gc_->HasPendingWork()) {
+    std::expected<void, std::runtime_error> step_res = StepCollector(data, true);
+
+    if (!step_res.has_value()) {
+      return std::unexpected(step_res.error());
+    }
+  }
+
   const size_t total_size = vtable.GetSize();
-  char* raw_memory = nullptr;
 
-  try {
-    raw_memory = allocator_.allocate(total_size);
-  } catch (const std::bad_alloc&) {
-    return std::unexpected(std::runtime_error("MemoryManager: Allocation failed - out of memory"));
+  // A lazy sweep may still hold enough garbage for the request; a running mark cannot be finished from here
+  if (ExceedsHeapLimit(total_size) && gc_ && gc_->HasPendingWork() && !gc_in_progress_) {
+    gc_in_progress_ = true;
+    std::expected<void, std::runtime_error> sweep_res = gc_->FinishSweep(data);
+    gc_in_progress_ = false;
+
+    if (!gc_->HasPendingWork()) {
+      UpdateHeapTarget();
+    }
+
+    if (!sweep_res.has_value()) {
+      return std::unexpected(sweep_res.error());
+    }
   }
 
+  if (ExceedsHeapLimit(total_size)) {
+    return std::unexpected(std::runtime_error(
+        "MemoryManager: Allocation failed - heap limit of " + std::to_string(sizing_.max_heap_bytes) +
+        " bytes exceeded (requested " + std::to_string(total_size) + " bytes for " + vtable.GetName() +
+        ", allocated " + std::to_string(allocated_bytes_) + ", external " + std::to_string(external_bytes_) +
+        ", live objects " + std::to_string(repo_.GetCount()) + ")"));
+  }
+
+  char* raw_memory = gc_ ? gc_->AllocateStorage(vtable, total_size) : nullptr;
+
+  if (raw_memory == nullptr) {
+    try {
+      raw_memory = allocator_.allocate(total_size);
+    } catch (const std::bad_alloc&) {
+      return std::unexpected(std::runtime_error("MemoryManager: Allocation failed - out of memory"));
+    }
+  }
+
+  allocated_bytes_ += total_size;
+
   auto* descriptor = reinterpret_cast<ObjectDescriptor*>(raw_memory);
   descriptor->vtable_index = vtable_index;
   descriptor->badge = 0;
@@ -37,7 +88,7 @@ std::expected<void*, std::runtime_error> MemoryManager::AllocateObject(const Vir
   std::expected<void, std::runtime_error> add_result = repo_.Add(descriptor);
 
   if (!add_result.has_value()) {
-    allocator_.deallocate(raw_memory, total_size);
+    ReleaseStorage(raw_memory, total_size);
     return std::unexpected(add_result.error());
   }
 
@@ -60,30 +111,14 @@ std::expected<void, std::runtime_error> MemoryManager::DeallocateObject(void* ob
                                               std::to_string(desc->vtable_index)));
   }
 
-  std::string object_type = vt_res.value()->GetName();
   const VirtualTable* vt = vt_res.value();
 
-  std::expected<FunctionId, std::runtime_error> dtor_id_res = vt->GetRealFunctionId("_destructor_<M>");
-
-  if (!dtor_id_res.has_value()) {
-    return std::unexpected(std::runtime_error("DeallocateObject: Destructor not found for class " + object_type));
-  }
-
-  auto func_res = data.function_repository.GetById(dtor_id_res.value());
-
-  if (!func_res.has_value()) {
-    return std::unexpected(
-        std::runtime_error("DeallocateObject: Destructor function not found for class " + object_type));
-  }
-
-  runtime::StackFrame frame = {.function_name = "Object deallocation"};
-  data.memory.machine_stack.emplace(obj);
-  data.memory.stack_frames.push(std::move(frame));
-  std::expected<execution_tree::ExecutionResult, std::runtime_error> exec_res = func_res.value()->Execute(data);
-  data.memory.stack_frames.pop();
+  if (!vt->IsTriviallyDestructible()) {
+    std::expected<void, std::runtime_error> dtor_res = RunDestructor(obj, *vt, "Object deallocation", data);
 
-  if (!exec_res.has_value()) {
-    return std::unexpected(exec_res.error());
+    if (!dtor_res.has_value()) {
+      return std::unexpected(std::runtime_error(std::string("DeallocateObject: ") + dtor_res.error().what()));
+    }
   }
 
   const size_t total_size = vt->GetSize();
@@ -95,18 +130,90 @@ std::expected<void, std::runtime_error> MemoryManager::DeallocateObject(void* ob
     return std::unexpected(remove_res.error());
   }
 
-  allocator_.deallocate(raw, total_size);
+  pin_counts_.erase(obj);
+  ReportExternalMemory(obj, 0);
+  ReleaseStorage(raw, total_size);
 
   return {};
 }
 
-std::expected<void, std::runtime_error> MemoryManager::Clear(execution_tree::PassedExecutionData& data) {
+std::expected<void, std::runtime_error> MemoryManager::DeallocateObjects(
+    const std::vector<void*>& objects, execution_tree::PassedExecutionData& data) {
+  std::optional<std::runtime_error> first_error;
+  std::vector<BackgroundFreer::Block> deferred;
+
+  for (void* obj : objects) {
+    auto* desc = reinterpret_cast<ObjectDescriptor*>(obj);
+
+    std::expected<const VirtualTable*, std::runtime_error> vt_res =
+        data.virtual_table_repository.GetByIndex(desc->vtable_index);
+
+    std::expected<void, std::runtime_error> dealloc_res;
+
+    if (!vt_res.has_value() || !vt_res.value()->IsTriviallyDestructible()) {
+      dealloc_res = DeallocateObject(obj, data);
+    } else {
+      dealloc_res = repo_.Remove(desc);
+
+      if (dealloc_res.has_value()) {
+        const size_t size = vt_res.value()->GetSize();
+        char* raw = reinterpret_cast<char*>(obj);
+        pin_counts_.erase(obj);
+        ReportExternalMemory(obj, 0);
+        allocated_bytes_ -= size;
+
+        if (!gc_ || !gc_->ReleaseStorage(raw, size)) {
+          deferred.push_back({.raw = raw, .size = size});
+        }
+      }
+    }
+
+    if (!dealloc_res.has_value() && !first_error) {
+      first_error = dealloc_res.error();
+    }
+  }
+
+  if (deferred.size() >= kMinBackgroundFreeBatch) {
+    if (!background_freer_) {
+      background_freer_ = std::make_unique<BackgroundFreer>();
+    }
+
+    background_freer_->Submit(std::move(deferred));
+  } else {
+    for (const BackgroundFreer::Block& block : deferred) {
+      allocator_.deallocate(block.raw, block.size);
+    }
+  }
+
+  if (first_error) {
+    return std::unexpected(*first_error);
+  }
+
+  return {};
+}
+
+std::expected<void, std::runtime_error> MemoryManager::Clear(execution_tree::PassedExecutionData& data,
+                                                             TeardownMode mode) {
   gc_in_progress_ = true;
 
   std::vector<void*> objects_to_clear;
-  objects_to_clear.reserve(repo_.GetCount());
 
-  repo_.ForAll([&objects_to_clear](void* obj) { objects_to_clear.push_back(obj); });
+  if (mode == TeardownMode::kFull) {
+    objects_to_clear.reserve(repo_.GetCount());
+  }
+
+  repo_.ForAll([&objects_to_clear, &data, mode](void* obj) {
+    if (mode == TeardownMode::kFast) {
+      std::expected<const VirtualTable*, std::runtime_error> vt_res =
+          data.virtual_table_repository.GetByIndex(reinterpret_cast<ObjectDescriptor*>(obj)->vtable_index);
+
+      if (vt_res.has_value() && (vt_res.value()->IsTriviallyDestructible() || vt_res.value()->IsHeapOnly())) {
+        return;
+      }
+    }
+
+    objects_to_clear.push_back(obj);
+  });
 
   std::optional<std::runtime_error> first_error;
 
@@ -126,24 +233,14 @@ std::expected<void, std::runtime_error> MemoryManager::Clear(execution_tree::Pas
 
     const VirtualTable* vt = vt_res.value();
 
-    std::expected<FunctionId, std::runtime_error> dtor_id_res = vt->GetRealFunctionId("_destructor_<M>");
-
-    if (dtor_id_res.has_value()) {
-      auto func_res = data.function_repository.GetById(dtor_id_res.value());
+    if (!vt->IsTriviallyDestructible() && ResolveDestructor(*vt, data).has_value()) {
+      std::expected<void, std::runtime_error> dtor_res = RunDestructor(obj, *vt, "Object deallocation (Clear)", data);
 
-      if (func_res.has_value()) {
-        runtime::StackFrame frame = {.function_name = "Object deallocation (Clear)"};
-        data.memory.machine_stack.emplace(obj);
-        data.memory.stack_frames.push(std::move(frame));
-        std::expected<execution_tree::ExecutionResult, std::runtime_error> exec_res = func_res.value()->Execute(data);
-        data.memory.stack_frames.pop();
-
-        if (!exec_res.has_value()) {
-          if (!first_error) {
-            first_error = exec_res.error();
-          }
-          continue;
+      if (!dtor_res.has_value()) {
+        if (!first_error) {
+          first_error = dtor_res.error();
         }
+        continue;
       }
     }
 
@@ -159,10 +256,25 @@ std::expected<void, std::runtime_error> MemoryManager::Clear(execution_tree::Pas
     const size_t total_size = vt->GetSize();
     char* raw = reinterpret_cast<char*>(obj);
 
-    allocator_.deallocate(raw, total_size);
+    ReleaseStorage(raw, total_size);
   }
 
   repo_.Clear();
+  pin_counts_.clear();
+  box_cache_.Reset();
+  string_pool_.Reset();
+
+  if (gc_) {
+    gc_->Reset();
+  }
+
+  allocated_bytes_ = 0;
+  external_bytes_ = 0;
+  external_bytes_by_object_.clear();
+  external_bytes_by_vtable_.clear();
+  UpdateHeapTarget();
+
+  write_barrier_active_ = false;
 
   if (first_error.has_value()) {
     return std::unexpected(*first_error);
@@ -182,6 +294,12 @@ std::expected<void, std::runtime_error> MemoryManager::CollectGarbage(execution_
     gc_in_progress_ = true;
     auto gc_res = gc_->Collect(data);
     gc_in_progress_ = false;
+    write_barrier_active_ = gc_->IsMarking();
+
+    if (!gc_->HasPendingWork()) {
+      UpdateHeapTarget();
+    }
+
     return gc_res;
   }
 
@@ -190,19 +308,289 @@ std::expected<void, std::runtime_error> MemoryManager::CollectGarbage(execution_
 
 std::expected<void, std::runtime_error> MemoryManager::CollectGarbageIfRequired(
     execution_tree::PassedExecutionData& data) {
-  if (repo_.GetCount() > gc_threshold_) {
-    std::expected<void, std::runtime_error> collect_res = CollectGarbage(data);
+  if (gc_ && gc_->HasPendingWork()) {
+    return StepCollector(data, false);
+  }
 
-    if (!collect_res.has_value()) {
-      return std::unexpected(collect_res.error());
+  if (allocated_bytes_ + external_bytes_ > heap_target_) {
+    if (!gc_) {
+      return std::unexpected(std::runtime_error("MemoryManager: No GC configured"));
     }
+
+    return BeginCollection(data);
+  }
+
+  return {};
+}
+
+std::expected<void, std::runtime_error> MemoryManager::CollectGarbageWhileIdle(
+    execution_tree::PassedExecutionData& data, std::chrono::nanoseconds budget) {
+  if (!gc_ || gc_in_progress_) {
+    return {};
+  }
+
+  const auto deadline = std::chrono::steady_clock::now() + budget;
+
+  if (!gc_->HasPendingWork()) {
+    const auto idle_threshold = static_cast<double>(heap_target_) * sizing_.idle_collection_fraction;
+
+    if (static_cast<double>(allocated_bytes_ + external_bytes_) < idle_threshold || last_collection_pause_ > budget) {
+      return {};
+    }
+
+    std::expected<void, std::runtime_error> begin_res = BeginCollection(data);
+
+    if (!begin_res.has_value()) {
+      return begin_res;
+    }
+  }
+
+  while (gc_->HasPendingWork() && std::chrono::steady_clock::now() < deadline) {
+    std::expected<void, std::runtime_error> step_res = StepCollector(data, false);
+
+    if (!step_res.has_value()) {
+      return step_res;
+    }
+  }
+
+  return {};
+}
+
+void MemoryManager::WriteBarrier(void* ref) {
+  if (write_barrier_active_ && ref != nullptr) {
+    gc_->WriteBarrier(ref);
+  }
+}
+
+void MemoryManager::WriteBarrier(const Variable& value) {
+  if (write_barrier_active_ && std::holds_alternative<void*>(value)) {
+    WriteBarrier(std::get<void*>(value));
+  }
+}
+
+void MemoryManager::Pin(void* obj) {
+  ++pin_counts_[obj];
+}
+
+void MemoryManager::Unpin(void* obj) {
+  auto it = pin_counts_.find(obj);
+
+  if (it == pin_counts_.end()) {
+    return;
+  }
+
+  if (--it->second == 0) {
+    pin_counts_.erase(it);
+  }
+}
+
+bool MemoryManager::IsPinned(void* obj) const {
+  return pin_counts_.contains(obj);
+}
+
+std::expected<void, std::runtime_error> MemoryManager::MoveObject(void* from, void* to, size_t size) {
+  if (IsPinned(from)) {
+    return std::unexpected(std::runtime_error("MoveObject: object is pinned"));
+  }
+
+  std::expected<void, std::runtime_error> remove_res = repo_.Remove(reinterpret_cast<ObjectDescriptor*>(from));
+
+  if (!remove_res.has_value()) {
+    return std::unexpected(remove_res.error());
+  }
+
+  std::memmove(to, from, size);
+
+  auto external_it = external_bytes_by_object_.find(from);
+
+  if (external_it != external_bytes_by_object_.end()) {
+    const size_t bytes = external_it->second;
+    external_bytes_by_object_.erase(external_it);
+    external_bytes_by_object_.emplace(to, bytes);
+  }
+
+  return repo_.Add(reinterpret_cast<ObjectDescriptor*>(to));
+}
+
+void MemoryManager::ReportExternalMemory(void* obj, size_t bytes) {
+  auto it = external_bytes_by_object_.find(obj);
+  const size_t previous = it == external_bytes_by_object_.end() ? 0 : it->second;
+
+  if (bytes == previous) {
+    return;
+  }
+
+  const uint32_t vtable_index = reinterpret_cast<ObjectDescriptor*>(obj)->vtable_index;
+
+  if (external_bytes_by_vtable_.size() <= vtable_index) {
+    external_bytes_by_vtable_.resize(vtable_index + 1, 0);
+  }
+
+  external_bytes_ = external_bytes_ - previous + bytes;
+  external_bytes_by_vtable_[vtable_index] = external_bytes_by_vtable_[vtable_index] - previous + bytes;
+
+  if (bytes == 0) {
+    external_bytes_by_object_.erase(it);
+  } else {
+    external_bytes_by_object_[obj] = bytes;
+  }
+}
+
+std::expected<void, std::runtime_error> MemoryManager::StepCollector(execution_tree::PassedExecutionData& data,
+                                                                     bool inside_allocation) {
+  if (gc_in_progress_) {
+    return {};
+  }
+
+  gc_in_progress_ = true;
+  std::expected<void, std::runtime_error> step_res = inside_allocation ? gc_->AllocationStep(data) : gc_->Step(data);
+  gc_in_progress_ = false;
+  write_barrier_active_ = gc_->IsMarking();
+
+  if (!gc_->HasPendingWork()) {
+    UpdateHeapTarget();
+  }
+
+  return step_res;
+}
+
+std::expected<void, std::runtime_error> MemoryManager::BeginCollection(execution_tree::PassedExecutionData& data) {
+  if (gc_in_progress_) {
+    return {};
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  gc_in_progress_ = true;
+  std::expected<void, std::runtime_error> collect_res = gc_->BeginCollection(data);
+  gc_in_progress_ = false;
+  last_collection_pause_ = std::chrono::steady_clock::now() - start;
+  write_barrier_active_ = gc_->IsMarking();
+
+  if (!gc_->HasPendingWork()) {
+    UpdateHeapTarget();
+  }
+
+  return collect_res;
+}
+
+std::expected<execution_tree::IFunctionExecutable*, std::runtime_error> MemoryManager::ResolveDestructor(
+    const VirtualTable& vt, execution_tree::PassedExecutionData& data) {
+  if (execution_tree::IFunctionExecutable* cached = vt.GetCachedDestructor()) {
+    return cached;
+  }
+
+  std::expected<FunctionId, std::runtime_error> dtor_id_res = vt.GetRealFunctionId("_destructor_<M>");
+
+  if (!dtor_id_res.has_value()) {
+    return std::unexpected(std::runtime_error("Destructor not found for class " + vt.GetName()));
+  }
+
+  std::expected<execution_tree::IFunctionExecutable*, std::runtime_error> func_res =
+      data.function_repository.GetById(dtor_id_res.value());
+
+  if (!func_res.has_value()) {
+    return std::unexpected(std::runtime_error("Destructor function not found for class " + vt.GetName()));
+  }
+
+  vt.CacheDestructor(func_res.value());
+
+  return func_res.value();
+}
+
+std::expected<void, std::runtime_error> MemoryManager::RunDestructor(void* obj,
+                                                                     const VirtualTable& vt,
+                                                                     const std::string& frame_name,
+                                                                     execution_tree::PassedExecutionData& data) {
+  std::expected<execution_tree::IFunctionExecutable*, std::runtime_error> dtor_res = ResolveDestructor(vt, data);
+
+  if (!dtor_res.has_value()) {
+    return std::unexpected(dtor_res.error());
+  }
+
+  runtime::StackFrame frame = {.function_name = frame_name, .local_variables = {}, .action_count = 0};
+  data.memory.machine_stack.emplace(obj);
+  data.memory.stack_frames.push(std::move(frame));
+  std::expected<execution_tree::ExecutionResult, std::runtime_error> exec_res = dtor_res.value()->Execute(data);
+  data.memory.stack_frames.pop();
+
+  if (!exec_res.has_value()) {
+    return std::unexpected(exec_res.error());
   }
 
   return {};
 }
 
+void MemoryManager::ReleaseStorage(char* raw, size_t size) {
+  allocated_bytes_ -= size;
+
+  if (gc_ && gc_->ReleaseStorage(raw, size)) {
+    return;
+  }
+
+  allocator_.deallocate(raw, size);
+}
+
+void MemoryManager::UpdateHeapTarget() {
+  const size_t live_bytes = allocated_bytes_ + external_bytes_;
+  size_t target = std::max(static_cast<size_t>(static_cast<double>(live_bytes) * sizing_.growth_factor),
+                           sizing_.initial_heap_bytes);
+
+  if (sizing_.max_heap_bytes != 0) {
+    target = std::min(target, sizing_.max_heap_bytes - sizing_.max_heap_bytes / kMaxHeapHeadroomDivisor);
+  }
+
+  heap_target_ = target;
+}
+
 const ObjectRepository& MemoryManager::GetRepository() const {
   return repo_;
 }
 
+BoxCache& MemoryManager::GetBoxCache() {
+  return box_cache_;
+}
+
+StringPool& MemoryManager::GetStringPool() {
+  return string_pool_;
+}
+
+size_t MemoryManager::GetAllocatedBytes() const {
+  return allocated_bytes_;
+}
+
+size_t MemoryManager::GetExternalBytes() const {
+  return external_bytes_;
+}
+
+size_t MemoryManager::GetExternalBytes(uint32_t vtable_index) const {
+  return vtable_index < external_bytes_by_vtable_.size() ? external_bytes_by_vtable_[vtable_index] : 0;
+}
+
+size_t MemoryManager::GetHeapTarget() const {
+  return heap_target_;
+}
+
+bool MemoryManager::ExceedsHeapLimit(size_t extra_bytes) const {
+  return sizing_.max_heap_bytes != 0 && allocated_bytes_ + external_bytes_ + extra_bytes > sizing_.max_heap_bytes;
+}
+
+bool MemoryManager::IsNearHeapLimit() const {
+  if (sizing_.max_heap_bytes == 0) {
+    return false;
+  }
+
+  return allocated_bytes_ + external_bytes_ >=
+         sizing_.max_heap_bytes - sizing_.max_heap_bytes / kMaxHeapHeadroomDivisor;
+}
+
+void MemoryManager::WaitForBackgroundFrees() {
+  if (background_freer_) {
+    background_freer_->WaitIdle();
+  }
+}
+
+size_t MemoryManager::GetBackgroundFreedObjects() const {
+  return background_freer_ ? background_freer_->GetFreedBlocks() : 0;
+}
+
 } // namespace ovum::vm::runtime
@@ -1,41 +1,116 @@
 #ifndef RUNTIME_MEMORYMANAGER_HPP
 #define RUNTIME_MEMORYMANAGER_HPP
 
+#include <chrono>
+#include <cstdint>
 #include <expected>
 #include <memory>
 #include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
+#include "lib/runtime/gc/BackgroundFreer.hpp"
 #include "lib/runtime/gc/IGarbageCollector.hpp"
 
+#include "BoxCache.hpp"
+#include "HeapSizing.hpp"
 #include "ObjectRepository.hpp"
+#include "StringPool.hpp"
+#include "Variable.hpp"
 #include "VirtualTable.hpp"
 
 namespace ovum::vm::execution_tree {
 struct PassedExecutionData;
+class IFunctionExecutable;
 } // namespace ovum::vm::execution_tree
 
 namespace ovum::vm::runtime {
 
+// kFast is only valid right before the process exits: only destructors of objects owning more than process memory
+// run, everything else is forgotten without releasing its allocator storage, which is left to the operating system
+enum class TeardownMode : uint8_t {
+  kFull,
+  kFast,
+};
+
 class MemoryManager {
 public:
-  MemoryManager(std::unique_ptr<IGarbageCollector> gc, size_t max_objects);
+  explicit MemoryManager(std::unique_ptr<IGarbageCollector> gc, HeapSizing sizing = {});
 
   std::expected<void*, std::runtime_error> AllocateObject(const VirtualTable& vtable,
                                                           uint32_t vtable_index,
                                                           execution_tree::PassedExecutionData& data);
   std::expected<void, std::runtime_error> DeallocateObject(void* obj, execution_tree::PassedExecutionData& data);
+  // Frees a batch of dead objects; trivially destructible ones never enter the interpreter and large batches of them
+  // are returned to the system allocator on a background thread
+  std::expected<void, std::runtime_error> DeallocateObjects(const std::vector<void*>& objects,
+                                                            execution_tree::PassedExecutionData& data);
   std::expected<void, std::runtime_error> CollectGarbage(execution_tree::PassedExecutionData& data);
   std::expected<void, std::runtime_error> CollectGarbageIfRequired(execution_tree::PassedExecutionData& data);
-  std::expected<void, std::runtime_error> Clear(execution_tree::PassedExecutionData& data);
+  // Called where the program waits anyway; advances pending collector work or starts a collection early, giving up
+  // once the budget is spent. A collection is only started if the last one paused for less than the budget.
+  std::expected<void, std::runtime_error> CollectGarbageWhileIdle(execution_tree::PassedExecutionData& data,
+                                                                  std::chrono::nanoseconds budget);
+  std::expected<void, std::runtime_error> Clear(execution_tree::PassedExecutionData& data,
+                                                TeardownMode mode = TeardownMode::kFull);
+
+  void WriteBarrier(void* ref);
+  void WriteBarrier(const Variable& value);
+
+  // Pinned objects are never moved by a compacting collector; pins nest
+  void Pin(void* obj);
+  void Unpin(void* obj);
+  [[nodiscard]] bool IsPinned(void* obj) const;
+  std::expected<void, std::runtime_error> MoveObject(void* from, void* to, size_t size);
+
+  // Builtins report the current size of the payload an object keeps outside the GC heap, such as a vector buffer;
+  // the change since the previous report counts towards the heap target
+  void ReportExternalMemory(void* obj, size_t bytes);
 
   [[nodiscard]] const ObjectRepository& GetRepository() const;
+  [[nodiscard]] BoxCache& GetBoxCache();
+  [[nodiscard]] StringPool& GetStringPool();
+  [[nodiscard]] size_t GetAllocatedBytes() const;
+  [[nodiscard]] size_t GetExternalBytes() const;
+  [[nodiscard]] size_t GetExternalBytes(uint32_t vtable_index) const;
+  [[nodiscard]] size_t GetHeapTarget() const;
+  // True once the heap has grown into the headroom kept below the hard limit; soft references are cleared then
+  [[nodiscard]] bool IsNearHeapLimit() const;
+  // Waits until storage handed to the background thread has been freed
+  void WaitForBackgroundFrees();
+  [[nodiscard]] size_t GetBackgroundFreedObjects() const;
 
 private:
+  std::expected<void, std::runtime_error> StepCollector(execution_tree::PassedExecutionData& data,
+                                                        bool inside_allocation);
+  std::expected<void, std::runtime_error> BeginCollection(execution_tree::PassedExecutionData& data);
+  static std::expected<execution_tree::IFunctionExecutable*, std::runtime_error> ResolveDestructor(
+      const VirtualTable& vt, execution_tree::PassedExecutionData& data);
+  static std::expected<void, std::runtime_error> RunDestructor(void* obj,
+                                                               const VirtualTable& vt,
+                                                               const std::string& frame_name,
+                                                               execution_tree::PassedExecutionData& data);
+  void ReleaseStorage(char* raw, size_t size);
+  void UpdateHeapTarget();
+  [[nodiscard]] bool ExceedsHeapLimit(size_t extra_bytes) const;
+
   ObjectRepository repo_;
+  BoxCache box_cache_;
+  StringPool string_pool_;
   std::allocator<char> allocator_;
+  std::unique_ptr<BackgroundFreer> background_freer_; // started with the first large batch
   std::unique_ptr<IGarbageCollector> gc_;
-  size_t gc_threshold_;
+  HeapSizing sizing_;
+  size_t allocated_bytes_;
+  size_t external_bytes_;
+  size_t heap_target_;
+  std::chrono::nanoseconds last_collection_pause_;
   bool gc_in_progress_;
+  bool write_barrier_active_;
+  std::unordered_map<void*, size_t> pin_counts_;
+  std::unordered_map<void*, size_t> external_bytes_by_object_;
+  std::vector<size_t> external_bytes_by_vtable_;
 };
 
 } // namespace ovum::vm::runtime
@@ -0,0 +1,28 @@
+#include "MethodSlots.hpp"
+
+#include "NameInterner.hpp"
+
+namespace ovum::vm::runtime {
+
+namespace {
+
+NameInterner& GetRegistry() {
+  static NameInterner registry;
+  return registry;
+}
+
+} // namespace
+
+size_t MethodSlots::GetOrAssign(const FunctionId& virtual_function_id) {
+  return GetRegistry().GetOrAssign(virtual_function_id);
+}
+
+const FunctionId& MethodSlots::GetName(size_t slot) {
+  return GetRegistry().GetName(slot);
+}
+
+size_t MethodSlots::GetCount() {
+  return GetRegistry().GetCount();
+}
+
+} // namespace ovum::vm::runtime
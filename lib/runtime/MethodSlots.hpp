@@ -0,0 +1,21 @@
+#ifndef RUNTIME_METHODSLOTS_HPP
+#define RUNTIME_METHODSLOTS_HPP
+
+#include <cstddef>
+
+#include "FunctionId.hpp"
+
+namespace ovum::vm::runtime {
+
+// Numbers every distinct virtual method signature once per process, so a call site can resolve its method to a slot
+// when it is parsed and dispatch through the slot tables of the VirtualTables at run time
+class MethodSlots {
+public:
+  [[nodiscard]] static size_t GetOrAssign(const FunctionId& virtual_function_id);
+  [[nodiscard]] static const FunctionId& GetName(size_t slot);
+  [[nodiscard]] static size_t GetCount();
+};
+
+} // namespace ovum::vm::runtime
+
+#endif // RUNTIME_METHODSLOTS_HPP
@@ -0,0 +1,39 @@
+#ifndef RUNTIME_NAMEINTERNER_HPP
+#define RUNTIME_NAMEINTERNER_HPP
+
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <unordered_map>
+
+namespace ovum::vm::runtime {
+
+// Hands out dense numbers for names in first-seen order; a name keeps its number for the lifetime of the interner
+class NameInterner {
+public:
+  size_t GetOrAssign(const std::string& name) {
+    auto [it, inserted] = id_by_name_.try_emplace(name, names_.size());
+
+    if (inserted) {
+      names_.push_back(name);
+    }
+
+    return it->second;
+  }
+
+  [[nodiscard]] const std::string& GetName(size_t id) const {
+    return names_.at(id);
+  }
+
+  [[nodiscard]] size_t GetCount() const {
+    return names_.size();
+  }
+
+private:
+  std::unordered_map<std::string, size_t> id_by_name_;
+  std::deque<std::string> names_;
+};
+
+} // namespace ovum::vm::runtime
+
+#endif // RUNTIME_NAMEINTERNER_HPP
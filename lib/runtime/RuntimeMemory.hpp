@@ -9,11 +9,52 @@
 
 namespace ovum::vm::runtime {
 
+namespace detail {
+
+// std::stack keeps its container protected; a derived type may still name the member to reach it
+template<typename Stack>
+typename Stack::container_type& UnderlyingContainer(Stack& stack) {
+  struct Access : Stack {
+    static typename Stack::container_type& Get(Stack& s) {
+      return s.*&Access::c;
+    }
+  };
+
+  return Access::Get(stack);
+}
+
+} // namespace detail
+
 struct RuntimeMemory {
   VariableCollection global_variables;
   std::stack<StackFrame> stack_frames;
   VariableStack machine_stack;
   ObjectRepository object_repository;
+
+  // Objects held by native code across a safepoint; push before the safepoint and pop once the object is published
+  VariableCollection temporary_roots;
+
+  // Visits every root slot in place without copying the stacks; the visitor may rewrite the slot
+  template<typename Visitor>
+  void ForEachRoot(Visitor&& visitor) {
+    for (Variable& var : global_variables) {
+      visitor(var);
+    }
+
+    for (StackFrame& frame : detail::UnderlyingContainer(stack_frames)) {
+      for (Variable& var : frame.local_variables) {
+        visitor(var);
+      }
+    }
+
+    for (Variable& var : detail::UnderlyingContainer(machine_stack)) {
+      visitor(var);
+    }
+
+    for (Variable& var : temporary_roots) {
+      visitor(var);
+    }
+  }
 };
 
 } // namespace ovum::vm::runtime
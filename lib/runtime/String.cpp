@@ -0,0 +1,121 @@
+#include "String.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace ovum::vm::runtime {
+
+String::String(std::string value) : length_(value.size()) {
+  if (!value.empty()) {
+    buffer_ = std::make_shared<const std::string>(std::move(value));
+  }
+}
+
+String::String(std::string_view value) : String(std::string(value)) {
+}
+
+String::String(const char* value) : String(std::string_view(value)) {
+}
+
+String::String(std::shared_ptr<const std::string> buffer, size_t offset, size_t length) :
+    buffer_(std::move(buffer)), offset_(offset), length_(length) {
+}
+
+String String::Substring(size_t start, size_t length) const {
+  start = std::min(start, length_);
+  length = std::min(length, length_ - start);
+
+  if (length == 0) {
+    return String();
+  }
+
+  if (length == length_) {
+    return *this;
+  }
+
+  if (length * kMaxRetainedRatio < buffer_->size()) {
+    return String(View().substr(start, length));
+  }
+
+  return String(buffer_, offset_ + start, length);
+}
+
+String String::Concat(const String& other) const {
+  if (other.Empty()) {
+    return *this;
+  }
+
+  if (Empty()) {
+    return other;
+  }
+
+  std::string result;
+  result.reserve(length_ + other.length_);
+  result.append(View());
+  result.append(other.View());
+
+  return String(std::move(result));
+}
+
+std::string_view String::View() const {
+  if (buffer_ == nullptr) {
+    return {};
+  }
+
+  return std::string_view(*buffer_).substr(offset_, length_);
+}
+
+std::string String::ToStdString() const {
+  return std::string(View());
+}
+
+size_t String::Size() const {
+  return length_;
+}
+
+bool String::Empty() const {
+  return length_ == 0;
+}
+
+size_t String::BufferBytes() const {
+  if (buffer_ == nullptr) {
+    return 0;
+  }
+
+  if (buffer_.use_count() > 1) {
+    return length_;
+  }
+
+  return sizeof(std::string) + buffer_->capacity();
+}
+
+size_t String::GetHash() const {
+  if (!has_hash_) {
+    hash_ = std::hash<std::string_view>{}(View());
+    has_hash_ = true;
+  }
+
+  return hash_;
+}
+
+bool String::operator==(const String& other) const {
+  if (length_ != other.length_) {
+    return false;
+  }
+
+  if (buffer_ == other.buffer_ && offset_ == other.offset_) {
+    return true;
+  }
+
+  if (has_hash_ && other.has_hash_ && hash_ != other.hash_) {
+    return false;
+  }
+
+  return View() == other.View();
+}
+
+bool String::operator<(const String& other) const {
+  return View() < other.View();
+}
+
+} // namespace ovum::vm::runtime
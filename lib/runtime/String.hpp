@@ -0,0 +1,64 @@
+#ifndef RUNTIME_STRING_HPP
+#define RUNTIME_STRING_HPP
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace ovum::vm::runtime {
+
+// Payload of the String builtin: an immutable view into a refcounted character buffer. Copies and substrings share
+// the buffer instead of duplicating it, and the hash is computed once and cached in the payload.
+class String {
+public:
+  // A substring keeps sharing its parent only while it covers at least 1/kMaxRetainedRatio of the buffer; smaller
+  // slices are copied out so that they do not pin a large parent in memory
+  static constexpr size_t kMaxRetainedRatio = 4;
+
+  String() = default;
+  explicit String(std::string value);
+  explicit String(std::string_view value);
+  explicit String(const char* value);
+
+  [[nodiscard]] String Substring(size_t start, size_t length) const;
+  [[nodiscard]] String Concat(const String& other) const;
+
+  [[nodiscard]] std::string_view View() const;
+  [[nodiscard]] std::string ToStdString() const;
+  [[nodiscard]] size_t Size() const;
+  [[nodiscard]] bool Empty() const;
+
+  // Bytes to charge to this string: the whole buffer while it is the only holder, otherwise just its slice, so a
+  // buffer shared by several strings is not counted once per holder
+  [[nodiscard]] size_t BufferBytes() const;
+
+  // Same value as std::hash<std::string> of the contents
+  [[nodiscard]] size_t GetHash() const;
+
+  [[nodiscard]] bool operator==(const String& other) const;
+  [[nodiscard]] bool operator<(const String& other) const;
+
+private:
+  String(std::shared_ptr<const std::string> buffer, size_t offset, size_t length);
+
+  std::shared_ptr<const std::string> buffer_;
+  size_t offset_ = 0;
+  size_t length_ = 0;
+  mutable size_t hash_ = 0;
+  mutable bool has_hash_ = false;
+};
+
+} // namespace ovum::vm::runtime
+
+namespace std {
+template<>
+struct hash<ovum::vm::runtime::String> {
+  size_t operator()(const ovum::vm::runtime::String& str) const {
+    return str.GetHash();
+  }
+};
+} // namespace std
+
+#endif // RUNTIME_STRING_HPP
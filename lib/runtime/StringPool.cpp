@@ -0,0 +1,57 @@
+#include "StringPool.hpp"
+
+#include <new>
+
+#include "lib/runtime/gc/IGarbageCollector.hpp"
+
+#include "ObjectDescriptor.hpp"
+#include "String.hpp"
+
+namespace ovum::vm::runtime {
+
+std::expected<void*, std::runtime_error> StringPool::Intern(const std::string& literal,
+                                                            const VirtualTableRepository& vtables) {
+  auto it = strings_.find(literal);
+
+  if (it != strings_.end()) {
+    return it->second.get();
+  }
+
+  auto vtable_index = vtables.GetBuiltinTypes().GetIndex(BuiltinType::kString);
+
+  if (!vtable_index.has_value()) {
+    return std::unexpected(vtable_index.error());
+  }
+
+  auto vtable = vtables.GetByIndex(vtable_index.value());
+
+  if (!vtable.has_value()) {
+    return std::unexpected(vtable.error());
+  }
+
+  std::unique_ptr<char[], PooledStringDeleter> storage(new char[vtable.value()->GetSize()]);
+  auto* descriptor = reinterpret_cast<ObjectDescriptor*>(storage.get());
+  descriptor->vtable_index = static_cast<uint32_t>(vtable_index.value());
+  descriptor->badge = kMarkBit | kImmortalBit;
+  new (storage.get() + sizeof(ObjectDescriptor)) String(literal);
+
+  void* obj = storage.get();
+  strings_.emplace(literal, std::move(storage));
+
+  return obj;
+}
+
+void StringPool::Reset() {
+  strings_.clear();
+}
+
+size_t StringPool::GetCount() const {
+  return strings_.size();
+}
+
+void StringPool::PooledStringDeleter::operator()(char* raw) const {
+  std::launder(reinterpret_cast<String*>(raw + sizeof(ObjectDescriptor)))->~String();
+  delete[] raw;
+}
+
+} // namespace ovum::vm::runtime
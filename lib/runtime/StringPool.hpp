@@ -0,0 +1,35 @@
+#ifndef RUNTIME_STRINGPOOL_HPP
+#define RUNTIME_STRINGPOOL_HPP
+
+#include <cstddef>
+#include <expected>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+#include "VirtualTableRepository.hpp"
+
+namespace ovum::vm::runtime {
+
+// One immortal String object per distinct literal of the program, filled by the parser. Like cached boxes the strings
+// live outside the object repository and stay marked, so they are never traced, moved or freed. Stores into a
+// variable or field copy them, so the pooled objects themselves are never assigned into.
+class StringPool {
+public:
+  std::expected<void*, std::runtime_error> Intern(const std::string& literal, const VirtualTableRepository& vtables);
+  void Reset();
+
+  [[nodiscard]] size_t GetCount() const;
+
+private:
+  struct PooledStringDeleter {
+    void operator()(char* raw) const;
+  };
+
+  std::unordered_map<std::string, std::unique_ptr<char[], PooledStringDeleter>> strings_;
+};
+
+} // namespace ovum::vm::runtime
+
+#endif // RUNTIME_STRINGPOOL_HPP
@@ -0,0 +1,24 @@
+#include "TypeIds.hpp"
+
+#include "NameInterner.hpp"
+
+namespace ovum::vm::runtime {
+
+namespace {
+
+NameInterner& GetRegistry() {
+  static NameInterner registry;
+  return registry;
+}
+
+} // namespace
+
+size_t TypeIds::GetOrAssign(const std::string& type_name) {
+  return GetRegistry().GetOrAssign(type_name);
+}
+
+const std::string& TypeIds::GetName(size_t type_id) {
+  return GetRegistry().GetName(type_id);
+}
+
+} // namespace ovum::vm::runtime
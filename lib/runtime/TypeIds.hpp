@@ -0,0 +1,19 @@
+#ifndef RUNTIME_TYPEIDS_HPP
+#define RUNTIME_TYPEIDS_HPP
+
+#include <cstddef>
+#include <string>
+
+namespace ovum::vm::runtime {
+
+// Numbers every class, interface and primitive type name once per process. Type checks compare these numbers, so an
+// operand resolved at parse time stays valid for classes registered later, builtins included.
+class TypeIds {
+public:
+  [[nodiscard]] static size_t GetOrAssign(const std::string& type_name);
+  [[nodiscard]] static const std::string& GetName(size_t type_id);
+};
+
+} // namespace ovum::vm::runtime
+
+#endif // RUNTIME_TYPEIDS_HPP
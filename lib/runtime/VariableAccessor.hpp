@@ -1,21 +1,25 @@
 #ifndef RUNTIME_VARIABLEACCESSOR_HPP
 #define RUNTIME_VARIABLEACCESSOR_HPP
 
+#include <expected>
+#include <stdexcept>
 #include <string>
 #include <typeinfo>
 
-#include "IVariableAccessor.hpp"
+#include "FieldInfo.hpp"
+#include "Variable.hpp"
 
 namespace ovum::vm::runtime {
 
+// Reads and writes a field slot of a known primitive type directly, without going through a type-erased accessor
 template<VariableMemberType T>
-class VariableAccessor : public IVariableAccessor {
+class VariableAccessor {
 public:
-  Variable GetVariable(void* value_ptr) const override {
-    return {*reinterpret_cast<T*>(value_ptr)};
+  static Variable GetVariable(const void* value_ptr) {
+    return {*reinterpret_cast<const T*>(value_ptr)};
   }
 
-  std::expected<void, std::runtime_error> WriteVariable(void* value_ptr, const Variable& variable) const override {
+  static std::expected<void, std::runtime_error> WriteVariable(void* value_ptr, const Variable& variable) {
     if (!std::holds_alternative<T>(variable)) {
       return std::unexpected{std::runtime_error("Variable type mismatch: expected " + std::string(typeid(T).name()) +
                                                 ", got " + std::to_string(variable.index()))};
@@ -27,6 +31,50 @@ public:
   }
 };
 
+inline Variable ReadField(const FieldInfo& field, const void* object_ptr) {
+  const char* slot = static_cast<const char*>(object_ptr) + field.offset;
+
+  switch (field.type) {
+    case FieldType::kInt:
+      return VariableAccessor<int64_t>::GetVariable(slot);
+    case FieldType::kFloat:
+      return VariableAccessor<double>::GetVariable(slot);
+    case FieldType::kBool:
+      return VariableAccessor<bool>::GetVariable(slot);
+    case FieldType::kChar:
+      return VariableAccessor<char>::GetVariable(slot);
+    case FieldType::kByte:
+      return VariableAccessor<uint8_t>::GetVariable(slot);
+    case FieldType::kObject:
+      break;
+  }
+
+  return VariableAccessor<void*>::GetVariable(slot);
+}
+
+inline std::expected<void, std::runtime_error> WriteField(const FieldInfo& field,
+                                                          void* object_ptr,
+                                                          const Variable& variable) {
+  char* slot = static_cast<char*>(object_ptr) + field.offset;
+
+  switch (field.type) {
+    case FieldType::kInt:
+      return VariableAccessor<int64_t>::WriteVariable(slot, variable);
+    case FieldType::kFloat:
+      return VariableAccessor<double>::WriteVariable(slot, variable);
+    case FieldType::kBool:
+      return VariableAccessor<bool>::WriteVariable(slot, variable);
+    case FieldType::kChar:
+      return VariableAccessor<char>::WriteVariable(slot, variable);
+    case FieldType::kByte:
+      return VariableAccessor<uint8_t>::WriteVariable(slot, variable);
+    case FieldType::kObject:
+      break;
+  }
+
+  return VariableAccessor<void*>::WriteVariable(slot, variable);
+}
+
 } // namespace ovum::vm::runtime
 
 #endif // RUNTIME_VARIABLEACCESSOR_HPP
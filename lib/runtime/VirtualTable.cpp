@@ -2,25 +2,35 @@
 
 #include <utility>
 
+#include "MethodSlots.hpp"
+#include "TypeIds.hpp"
 #include "VariableAccessor.hpp"
+#include "lib/execution_tree/FunctionRepository.hpp"
 #include "lib/runtime/gc/reference_scanners/DefaultReferenceScanner.hpp"
 
 namespace ovum::vm::runtime {
 
-const std::unordered_map<std::string, std::shared_ptr<IVariableAccessor>> VirtualTable::kVariableAccessorsByTypeName = {
-    {"int", std::make_shared<VariableAccessor<int64_t>>()},
-    {"float", std::make_shared<VariableAccessor<double>>()},
-    {"bool", std::make_shared<VariableAccessor<bool>>()},
-    {"char", std::make_shared<VariableAccessor<char>>()},
-    {"byte", std::make_shared<VariableAccessor<uint8_t>>()},
-    {"Object", std::make_shared<VariableAccessor<void*>>()},
+const std::string VirtualTable::kReferenceTypeName = "Object";
+
+const std::unordered_map<std::string, FieldType> VirtualTable::kFieldTypesByTypeName = {
+    {"int", FieldType::kInt},
+    {"float", FieldType::kFloat},
+    {"bool", FieldType::kBool},
+    {"char", FieldType::kChar},
+    {"byte", FieldType::kByte},
+    {kReferenceTypeName, FieldType::kObject},
 };
 
 VirtualTable::VirtualTable(std::string name, size_t size, std::unique_ptr<IReferenceScanner> scanner) :
-    name_(std::move(name)), size_(size), reference_scanner_(std::move(scanner)) {
+    name_(std::move(name)), size_(size), type_id_(TypeIds::GetOrAssign(name_)), relocatable_(true),
+    trivially_destructible_(false), heap_only_(false),
+    reference_strength_(ReferenceStrength::kStrong), cached_destructor_(nullptr),
+    reference_scanner_(std::move(scanner)), has_custom_scanner_(reference_scanner_ != nullptr) {
   if (!reference_scanner_) {
     reference_scanner_ = std::make_unique<DefaultReferenceScanner>();
   }
+
+  SetTypeBit(type_id_);
 }
 
 std::string VirtualTable::GetName() const {
@@ -31,15 +41,27 @@ size_t VirtualTable::GetSize() const {
   return size_;
 }
 
+void VirtualTable::SetSize(size_t size) {
+  size_ = size;
+}
+
+std::expected<FieldType, std::runtime_error> VirtualTable::GetFieldType(const std::string& type_name) {
+  auto it = kFieldTypesByTypeName.find(type_name);
+
+  if (it == kFieldTypesByTypeName.end()) {
+    return std::unexpected{std::runtime_error("Unknown field type: " + type_name)};
+  }
+
+  return it->second;
+}
+
 std::expected<Variable, std::runtime_error> VirtualTable::GetVariableByIndex(void* object_ptr, size_t index) const {
   if (index >= fields_.size()) {
     return std::unexpected{
         std::runtime_error("VTable of class " + name_ + " does not contain field number " + std::to_string(index))};
   }
 
-  const FieldInfo& field_info = fields_[index];
-
-  return field_info.variable_accessor->GetVariable(reinterpret_cast<char*>(object_ptr) + field_info.offset);
+  return ReadField(fields_[index], object_ptr);
 }
 
 std::expected<void, std::runtime_error> VirtualTable::SetVariableByIndex(void* object_ptr,
@@ -50,9 +72,7 @@ std::expected<void, std::runtime_error> VirtualTable::SetVariableByIndex(void* o
         std::runtime_error("VTable of class " + name_ + " does not contain field number " + std::to_string(index))};
   }
 
-  const FieldInfo& field_info = fields_[index];
-
-  return field_info.variable_accessor->WriteVariable(reinterpret_cast<char*>(object_ptr) + field_info.offset, variable);
+  return WriteField(fields_[index], object_ptr, variable);
 }
 
 std::expected<FunctionId, std::runtime_error> VirtualTable::GetRealFunctionId(
@@ -67,30 +87,154 @@ std::expected<FunctionId, std::runtime_error> VirtualTable::GetRealFunctionId(
   return function_info_it->second;
 }
 
+std::expected<execution_tree::IFunctionExecutable*, std::runtime_error> VirtualTable::GetFunctionBySlot(
+    size_t slot, const execution_tree::FunctionRepository& function_repository) const {
+  if (slot < slot_functions_.size() && slot_functions_[slot] != nullptr) {
+    return slot_functions_[slot];
+  }
+
+  std::expected<FunctionId, std::runtime_error> function_id = GetRealFunctionId(MethodSlots::GetName(slot));
+
+  if (!function_id.has_value()) {
+    return std::unexpected(function_id.error());
+  }
+
+  std::expected<execution_tree::IFunctionExecutable*, std::runtime_error> function =
+      function_repository.GetById(function_id.value());
+
+  if (!function.has_value()) {
+    return std::unexpected(function.error());
+  }
+
+  slot_functions_[slot] = function.value();
+
+  return function.value();
+}
+
+void VirtualTable::BindSlots(const execution_tree::FunctionRepository& function_repository) const {
+  for (const auto& [virtual_function_id, real_function_id] : functions_) {
+    std::expected<execution_tree::IFunctionExecutable*, std::runtime_error> function =
+        function_repository.GetById(real_function_id);
+
+    if (function.has_value()) {
+      slot_functions_[MethodSlots::GetOrAssign(virtual_function_id)] = function.value();
+    }
+  }
+}
+
 void VirtualTable::AddFunction(const FunctionId& virtual_function_id, const FunctionId& real_function_id) {
   functions_[virtual_function_id] = real_function_id;
+
+  const size_t slot = MethodSlots::GetOrAssign(virtual_function_id);
+
+  if (slot >= slot_functions_.size()) {
+    slot_functions_.resize(slot + 1, nullptr);
+  }
+
+  slot_functions_[slot] = nullptr;
 }
 
 size_t VirtualTable::AddField(const std::string& type_name, int64_t offset) {
-  fields_.emplace_back(offset, kVariableAccessorsByTypeName.at(type_name));
+  const FieldType type = kFieldTypesByTypeName.at(type_name);
+  fields_.push_back({.offset = offset, .type = type});
+
+  if (type == FieldType::kObject) {
+    reference_offsets_.push_back(offset);
+  }
 
   return fields_.size() - 1U;
 }
 
 void VirtualTable::AddInterface(const std::string& interface_name) {
-  interfaces_.insert(interface_name);
+  SetTypeBit(TypeIds::GetOrAssign(interface_name));
 }
 
 bool VirtualTable::IsType(const std::string& interface_name) const {
-  return interfaces_.contains(interface_name) || interface_name == name_;
+  return IsType(TypeIds::GetOrAssign(interface_name));
+}
+
+bool VirtualTable::IsType(size_t type_id) const {
+  const size_t word = type_id / kTypeBitsPerWord;
+
+  return word < type_bits_.size() && ((type_bits_[word] >> (type_id % kTypeBitsPerWord)) & 1U) != 0;
+}
+
+size_t VirtualTable::GetTypeId() const {
+  return type_id_;
 }
 
 size_t VirtualTable::GetFieldCount() const {
   return fields_.size();
 }
 
+bool VirtualTable::HasReferences() const {
+  return has_custom_scanner_ || !reference_offsets_.empty();
+}
+
+bool VirtualTable::IsRelocatable() const {
+  return relocatable_;
+}
+
+void VirtualTable::SetRelocatable(bool relocatable) {
+  relocatable_ = relocatable;
+}
+
+bool VirtualTable::IsTriviallyDestructible() const {
+  return trivially_destructible_;
+}
+
+void VirtualTable::SetTriviallyDestructible(bool trivially_destructible) {
+  trivially_destructible_ = trivially_destructible;
+}
+
+bool VirtualTable::IsHeapOnly() const {
+  return heap_only_;
+}
+
+void VirtualTable::SetHeapOnly(bool heap_only) {
+  heap_only_ = heap_only;
+}
+
+ReferenceStrength VirtualTable::GetReferenceStrength() const {
+  return reference_strength_;
+}
+
+void VirtualTable::SetReferenceStrength(ReferenceStrength strength) {
+  reference_strength_ = strength;
+}
+
+execution_tree::IFunctionExecutable* VirtualTable::GetCachedDestructor() const {
+  return cached_destructor_;
+}
+
+void VirtualTable::CacheDestructor(execution_tree::IFunctionExecutable* destructor) const {
+  cached_destructor_ = destructor;
+}
+
+void VirtualTable::SetTypeBit(size_t type_id) {
+  const size_t word = type_id / kTypeBitsPerWord;
+
+  if (word >= type_bits_.size()) {
+    type_bits_.resize(word + 1, 0);
+  }
+
+  type_bits_[word] |= uint64_t{1} << (type_id % kTypeBitsPerWord);
+}
+
 void VirtualTable::ScanReferences(void* obj, const ReferenceVisitor& visitor) const {
-  reference_scanner_->Scan(obj, fields_, visitor);
+  if (!HasReferences()) {
+    return;
+  }
+
+  reference_scanner_->Scan(obj, reference_offsets_, visitor);
+}
+
+void VirtualTable::UpdateReferences(void* obj, const ReferenceUpdater& updater) const {
+  if (!HasReferences()) {
+    return;
+  }
+
+  reference_scanner_->UpdateReferences(obj, reference_offsets_, updater);
 }
 
 } // namespace ovum::vm::runtime
@@ -1,28 +1,44 @@
 #ifndef RUNTIME_VIRTUAL_TABLE_HPP
 #define RUNTIME_VIRTUAL_TABLE_HPP
 
+#include <cstdint>
 #include <expected>
 #include <memory>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
-#include <unordered_set>
+#include <vector>
 
 #include "lib/runtime/gc/reference_scanners/IReferenceScanner.hpp"
 
 #include "FieldInfo.hpp"
 #include "FunctionId.hpp"
-#include "IVariableAccessor.hpp"
 #include "Variable.hpp"
 
+namespace ovum::vm::execution_tree {
+class IFunctionExecutable;
+class FunctionRepository;
+} // namespace ovum::vm::execution_tree
+
 namespace ovum::vm::runtime {
 
+// How a reference object holds its referent: weak referents are cleared once nothing else keeps them alive, soft
+// referents only when the heap is close to its limit
+enum class ReferenceStrength : uint8_t {
+  kStrong,
+  kWeak,
+  kSoft,
+};
+
 class VirtualTable {
 public:
   VirtualTable(std::string name, size_t size, std::unique_ptr<IReferenceScanner> scanner = nullptr);
 
   [[nodiscard]] std::string GetName() const;
   [[nodiscard]] size_t GetSize() const;
+  void SetSize(size_t size);
+
+  [[nodiscard]] static std::expected<FieldType, std::runtime_error> GetFieldType(const std::string& type_name);
 
   [[nodiscard]] std::expected<Variable, std::runtime_error> GetVariableByIndex(void* object_ptr, size_t index) const;
   std::expected<void, std::runtime_error> SetVariableByIndex(void* object_ptr,
@@ -30,26 +46,71 @@ public:
                                                              const Variable& variable) const;
   [[nodiscard]] std::expected<FunctionId, std::runtime_error> GetRealFunctionId(
       const FunctionId& virtual_function_id) const;
+
+  // Dispatch by MethodSlots number; the function bound to a slot is cached on first use
+  [[nodiscard]] std::expected<execution_tree::IFunctionExecutable*, std::runtime_error> GetFunctionBySlot(
+      size_t slot, const execution_tree::FunctionRepository& function_repository) const;
+  // Fills the slots of every method whose function is already registered
+  void BindSlots(const execution_tree::FunctionRepository& function_repository) const;
   [[nodiscard]] bool IsType(const std::string& interface_name) const;
+  // Single bit test against the class itself and its interfaces, by TypeIds number
+  [[nodiscard]] bool IsType(size_t type_id) const;
+  [[nodiscard]] size_t GetTypeId() const;
 
   [[nodiscard]] size_t GetFieldCount() const;
 
+  // Objects of a class that has neither reference fields nor a custom scanner are never scanned by the collector
+  [[nodiscard]] bool HasReferences() const;
+
+  // Relocatable objects may be moved with a plain memory copy by a compacting collector
+  [[nodiscard]] bool IsRelocatable() const;
+  void SetRelocatable(bool relocatable);
+
+  // Trivially destructible objects are freed without running their destructor
+  [[nodiscard]] bool IsTriviallyDestructible() const;
+  void SetTriviallyDestructible(bool trivially_destructible);
+
+  // Objects whose destructor only returns process memory may be skipped by a fast teardown at exit
+  [[nodiscard]] bool IsHeapOnly() const;
+  void SetHeapOnly(bool heap_only);
+
+  [[nodiscard]] ReferenceStrength GetReferenceStrength() const;
+  void SetReferenceStrength(ReferenceStrength strength);
+
+  // The destructor is resolved on first use; functions may be registered after the vtable
+  [[nodiscard]] execution_tree::IFunctionExecutable* GetCachedDestructor() const;
+  void CacheDestructor(execution_tree::IFunctionExecutable* destructor) const;
+
   void AddFunction(const FunctionId& virtual_function_id, const FunctionId& real_function_id);
   size_t AddField(const std::string& type_name, int64_t offset);
   void AddInterface(const std::string& interface_name);
 
   void ScanReferences(void* obj, const ReferenceVisitor& visitor) const;
+  void UpdateReferences(void* obj, const ReferenceUpdater& updater) const;
 
 private:
-  static const std::unordered_map<std::string, std::shared_ptr<IVariableAccessor>> kVariableAccessorsByTypeName;
+  void SetTypeBit(size_t type_id);
+
+  static constexpr size_t kTypeBitsPerWord = 64;
+  static const std::string kReferenceTypeName;
+  static const std::unordered_map<std::string, FieldType> kFieldTypesByTypeName;
 
   std::string name_;
   size_t size_;
   std::vector<FieldInfo> fields_;
+  std::vector<int64_t> reference_offsets_;
   std::unordered_map<FunctionId, FunctionId> functions_;
-  std::unordered_set<std::string> interfaces_;
+  mutable std::vector<execution_tree::IFunctionExecutable*> slot_functions_;
+  size_t type_id_;
+  std::vector<uint64_t> type_bits_;
+  bool relocatable_;
+  bool trivially_destructible_;
+  bool heap_only_;
+  ReferenceStrength reference_strength_;
+  mutable execution_tree::IFunctionExecutable* cached_destructor_;
 
   std::unique_ptr<IReferenceScanner> reference_scanner_;
+  bool has_custom_scanner_;
 };
 
 } // namespace ovum::vm::runtime
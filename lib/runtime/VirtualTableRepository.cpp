@@ -17,6 +17,7 @@ std::expected<size_t, std::runtime_error> VirtualTableRepository::Add(VirtualTab
 
   vtables_.emplace_back(std::move(table));
   index_by_name_[name] = vtables_.size() - 1U;
+  builtin_types_.Record(name, vtables_.size() - 1U);
 
   return vtables_.size() - 1U;
 }
@@ -72,4 +73,8 @@ size_t VirtualTableRepository::GetCount() const {
   return vtables_.size();
 }
 
+const BuiltinTypes& VirtualTableRepository::GetBuiltinTypes() const {
+  return builtin_types_;
+}
+
 } // namespace ovum::vm::runtime
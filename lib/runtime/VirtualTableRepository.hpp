@@ -8,6 +8,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "BuiltinTypes.hpp"
 #include "VirtualTable.hpp"
 
 namespace ovum::vm::runtime {
@@ -32,9 +33,12 @@ public:
 
   [[nodiscard]] size_t GetCount() const;
 
+  [[nodiscard]] const BuiltinTypes& GetBuiltinTypes() const;
+
 private:
   std::vector<VirtualTable> vtables_;
   std::unordered_map<std::string, size_t> index_by_name_;
+  BuiltinTypes builtin_types_;
 };
 
 } // namespace ovum::vm::runtime
@@ -0,0 +1,81 @@
+#include "BackgroundFreer.hpp"
+
+#include <memory>
+#include <utility>
+
+namespace ovum::vm::runtime {
+
+BackgroundFreer::BackgroundFreer() : worker_(&BackgroundFreer::Run, this) {
+}
+
+BackgroundFreer::~BackgroundFreer() {
+  {
+    std::lock_guard lock(mutex_);
+    stopping_ = true;
+  }
+
+  work_available_.notify_one();
+
+  worker_.join();
+
+  for (const std::vector<Block>& blocks : queue_) {
+    Free(blocks);
+  }
+}
+
+void BackgroundFreer::Submit(std::vector<Block> blocks) {
+  {
+    std::lock_guard lock(mutex_);
+    queue_.push_back(std::move(blocks));
+  }
+
+  work_available_.notify_one();
+}
+
+void BackgroundFreer::WaitIdle() {
+  std::unique_lock lock(mutex_);
+  idle_.wait(lock, [this] { return queue_.empty() && !busy_; });
+}
+
+size_t BackgroundFreer::GetFreedBlocks() const {
+  return freed_blocks_.load(std::memory_order_relaxed);
+}
+
+void BackgroundFreer::Run() {
+  std::unique_lock lock(mutex_);
+
+  while (true) {
+    work_available_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+
+    if (stopping_) {
+      return;
+    }
+
+    std::vector<std::vector<Block>> batches = std::move(queue_);
+    queue_.clear();
+    busy_ = true;
+    lock.unlock();
+
+    for (const std::vector<Block>& blocks : batches) {
+      Free(blocks);
+      freed_blocks_.fetch_add(blocks.size(), std::memory_order_relaxed);
+    }
+
+    lock.lock();
+    busy_ = false;
+
+    if (queue_.empty()) {
+      idle_.notify_all();
+    }
+  }
+}
+
+void BackgroundFreer::Free(const std::vector<Block>& blocks) {
+  std::allocator<char> allocator;
+
+  for (const Block& block : blocks) {
+    allocator.deallocate(block.raw, block.size);
+  }
+}
+
+} // namespace ovum::vm::runtime
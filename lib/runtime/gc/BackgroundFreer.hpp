@@ -0,0 +1,50 @@
+#ifndef RUNTIME_BACKGROUNDFREER_HPP
+#define RUNTIME_BACKGROUNDFREER_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ovum::vm::runtime {
+
+// Hands the storage of dead objects back to the system allocator on a worker thread. Only memory that no interpreter
+// code can observe anymore may be submitted.
+class BackgroundFreer {
+public:
+  struct Block {
+    char* raw;
+    size_t size;
+  };
+
+  BackgroundFreer();
+  ~BackgroundFreer();
+
+  BackgroundFreer(const BackgroundFreer&) = delete;
+  BackgroundFreer& operator=(const BackgroundFreer&) = delete;
+
+  void Submit(std::vector<Block> blocks);
+  // Blocks until every submitted block has been freed
+  void WaitIdle();
+
+  [[nodiscard]] size_t GetFreedBlocks() const;
+
+private:
+  void Run();
+  static void Free(const std::vector<Block>& blocks);
+
+  std::mutex mutex_;
+  std::condition_variable work_available_;
+  std::condition_variable idle_;
+  std::vector<std::vector<Block>> queue_;
+  bool busy_ = false;
+  bool stopping_ = false;
+  std::atomic<size_t> freed_blocks_{0};
+  std::thread worker_;
+};
+
+} // namespace ovum::vm::runtime
+
+#endif // RUNTIME_BACKGROUNDFREER_HPP
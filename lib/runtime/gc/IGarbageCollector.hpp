@@ -1,6 +1,7 @@
 #ifndef RUNTIME_GARBAGECOLLECTOR_HPP
 #define RUNTIME_GARBAGECOLLECTOR_HPP
 
+#include <cstddef>
 #include <cstdint>
 #include <expected>
 #include <stdexcept>
@@ -11,12 +12,63 @@ struct PassedExecutionData;
 
 namespace ovum::vm::runtime {
 
+class VirtualTable;
+
 constexpr uint32_t kMarkBit = 1U;
+// Set together with kMarkBit on objects that live outside the managed heap and are never freed
+constexpr uint32_t kImmortalBit = 2U;
 
 class IGarbageCollector { // NOLINT(cppcoreguidelines-special-member-functions)
 public:
   virtual ~IGarbageCollector() = default;
   virtual std::expected<void, std::runtime_error> Collect(execution_tree::PassedExecutionData& data) = 0;
+
+  // Starts a collection that later Step calls may finish; non-incremental collectors collect fully here
+  virtual std::expected<void, std::runtime_error> BeginCollection(execution_tree::PassedExecutionData& data) {
+    return Collect(data);
+  }
+
+  // Performs a bounded portion of deferred collection work at a safepoint
+  virtual std::expected<void, std::runtime_error> Step(execution_tree::PassedExecutionData& /*data*/) {
+    return {};
+  }
+
+  // Like Step, but called from inside an allocation, where not every live object is reachable from roots
+  virtual std::expected<void, std::runtime_error> AllocationStep(execution_tree::PassedExecutionData& /*data*/) {
+    return {};
+  }
+
+  // Frees all garbage found by a finished mark at once; like AllocationStep it may be called from inside an allocation
+  virtual std::expected<void, std::runtime_error> FinishSweep(execution_tree::PassedExecutionData& /*data*/) {
+    return {};
+  }
+
+  [[nodiscard]] virtual bool HasPendingWork() const {
+    return false;
+  }
+
+  // While this holds, every reference stored into the heap or a root has to be reported to WriteBarrier
+  [[nodiscard]] virtual bool IsMarking() const {
+    return false;
+  }
+
+  virtual void WriteBarrier(void* /*ref*/) {
+  }
+
+  // Collectors managing their own heap return storage for new objects here; nullptr leaves the allocation
+  // to the memory manager
+  virtual char* AllocateStorage(const VirtualTable& /*vtable*/, size_t /*size*/) {
+    return nullptr;
+  }
+
+  // Returns true if the storage came from AllocateStorage and is reclaimed by the collector itself
+  virtual bool ReleaseStorage(char* /*raw*/, size_t /*size*/) {
+    return false;
+  }
+
+  // Drops deferred work and heap state after the memory manager has released every object itself
+  virtual void Reset() {
+  }
 };
 
 } // namespace ovum::vm::runtime
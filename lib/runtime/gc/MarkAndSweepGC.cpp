@@ -1,75 +1,254 @@
 #include "MarkAndSweepGC.hpp"
 
 #include <optional>
-#include <queue>
-#include <stack>
+#include <utility>
 #include <vector>
 
 #include "lib/execution_tree/PassedExecutionData.hpp"
 #include "lib/runtime/ObjectDescriptor.hpp"
 #include "lib/runtime/VirtualTableRepository.hpp"
+#include "lib/runtime/gc/reference_scanners/WeakReferenceScanner.hpp"
 
 namespace ovum::vm::runtime {
 
+namespace {
+
+constexpr size_t kObjectsPerClockCheck = 64;
+
+} // namespace
+
+MarkAndSweepGC::MarkAndSweepGC(size_t lazy_sweep_batch_size, std::chrono::microseconds mark_slice_budget) :
+    lazy_sweep_batch_size_(lazy_sweep_batch_size), mark_slice_budget_(mark_slice_budget) {
+}
+
 std::expected<void, std::runtime_error> MarkAndSweepGC::Collect(execution_tree::PassedExecutionData& data) {
-  Mark(data);
-  return Sweep(data);
+  if (!marking_) {
+    std::expected<void, std::runtime_error> start_res = StartMarking(data);
+
+    if (!start_res.has_value()) {
+      return start_res;
+    }
+  }
+
+  return FinishMarking(data);
 }
 
-void MarkAndSweepGC::Mark(execution_tree::PassedExecutionData& data) {
-  std::queue<void*> worklist;
-  AddRoots(worklist, data);
+std::expected<void, std::runtime_error> MarkAndSweepGC::BeginCollection(execution_tree::PassedExecutionData& data) {
+  if (mark_slice_budget_ == std::chrono::microseconds::zero()) {
+    return Collect(data);
+  }
 
-  while (!worklist.empty()) {
-    void* obj = worklist.front();
-    worklist.pop();
+  if (!marking_) {
+    std::expected<void, std::runtime_error> start_res = StartMarking(data);
 
-    if (obj == nullptr) {
-      continue;
+    if (!start_res.has_value()) {
+      return start_res;
     }
+  }
 
-    auto* desc = reinterpret_cast<ObjectDescriptor*>(obj);
+  return Step(data);
+}
 
-    if (desc->badge & kMarkBit) {
-      continue;
-    }
+std::expected<void, std::runtime_error> MarkAndSweepGC::Step(execution_tree::PassedExecutionData& data) {
+  if (!marking_) {
+    return SweepPending(data, lazy_sweep_batch_size_);
+  }
+
+  // Close to the hard heap limit the mark is finished at once, so that its garbage can be reclaimed before an
+  // allocation fails
+  if (!data.memory_manager.IsNearHeapLimit() && !MarkSlice(data)) {
+    return {};
+  }
+
+  return FinishMarking(data);
+}
+
+std::expected<void, std::runtime_error> MarkAndSweepGC::AllocationStep(execution_tree::PassedExecutionData& data) {
+  // Objects referenced only from the native frame of the allocating command are invisible to the marker,
+  // so marking may only advance at safepoints; reclaiming garbage found by a finished mark is always safe
+  if (marking_) {
+    return {};
+  }
+
+  return SweepPending(data, lazy_sweep_batch_size_);
+}
+
+std::expected<void, std::runtime_error> MarkAndSweepGC::FinishSweep(execution_tree::PassedExecutionData& data) {
+  return SweepPending(data, pending_sweep_.size());
+}
 
-    desc->badge |= kMarkBit;
+bool MarkAndSweepGC::HasPendingWork() const {
+  return marking_ || !pending_sweep_.empty();
+}
 
-    std::expected<const VirtualTable*, std::runtime_error> vt_res =
-        data.virtual_table_repository.GetByIndex(desc->vtable_index);
+bool MarkAndSweepGC::IsMarking() const {
+  return marking_;
+}
 
-    if (!vt_res.has_value()) {
-      continue;
+void MarkAndSweepGC::WriteBarrier(void* ref) {
+  if (marking_) {
+    Shade(ref);
+  }
+}
+
+void MarkAndSweepGC::Reset() {
+  marking_ = false;
+  grey_objects_.clear();
+  discovered_references_.clear();
+  pending_sweep_.clear();
+}
+
+std::expected<void, std::runtime_error> MarkAndSweepGC::StartMarking(execution_tree::PassedExecutionData& data) {
+  // Garbage left over from the previous cycle is still unmarked, so it has to be gone before marking again
+  std::expected<void, std::runtime_error> finish_res = SweepPending(data, pending_sweep_.size());
+
+  if (!finish_res.has_value()) {
+    return finish_res;
+  }
+
+  marking_ = true;
+  discovered_references_.clear();
+  AddRoots(data);
+
+  return {};
+}
+
+bool MarkAndSweepGC::MarkSlice(execution_tree::PassedExecutionData& data) {
+  const auto deadline = std::chrono::steady_clock::now() + mark_slice_budget_;
+  size_t scanned = 0;
+
+  while (!grey_objects_.empty()) {
+    void* obj = grey_objects_.back();
+    grey_objects_.pop_back();
+    ScanObject(obj, data);
+
+    if (++scanned % kObjectsPerClockCheck == 0 && std::chrono::steady_clock::now() >= deadline) {
+      break;
     }
+  }
+
+  return grey_objects_.empty();
+}
+
+std::expected<void, std::runtime_error> MarkAndSweepGC::FinishMarking(execution_tree::PassedExecutionData& data) {
+  // Stores into roots are not covered by the write barrier, so roots are rescanned before marking completes
+  AddRoots(data);
+  DrainGreyObjects(data);
+  ProcessReferences(data);
+
+  marking_ = false;
+
+  return Sweep(data);
+}
 
-    const VirtualTable* vt = vt_res.value();
+void MarkAndSweepGC::ScanObject(void* obj, execution_tree::PassedExecutionData& data) {
+  auto* desc = reinterpret_cast<ObjectDescriptor*>(obj);
 
-    vt->ScanReferences(obj, [&worklist](void* ref) {
-      if (ref) {
-        worklist.push(ref);
+  std::expected<const VirtualTable*, std::runtime_error> vt_res =
+      data.virtual_table_repository.GetByIndex(desc->vtable_index);
+
+  if (!vt_res.has_value()) {
+    return;
+  }
+
+  if (vt_res.value()->GetReferenceStrength() != ReferenceStrength::kStrong) {
+    discovered_references_.emplace_back(obj, vt_res.value()->GetReferenceStrength());
+  }
+
+  vt_res.value()->ScanReferences(obj, [this](void* ref) { Shade(ref); });
+}
+
+void MarkAndSweepGC::DrainGreyObjects(execution_tree::PassedExecutionData& data) {
+  while (!grey_objects_.empty()) {
+    void* obj = grey_objects_.back();
+    grey_objects_.pop_back();
+    ScanObject(obj, data);
+  }
+}
+
+void MarkAndSweepGC::ProcessReferences(execution_tree::PassedExecutionData& data) {
+  // Soft referents survive unless memory is tight; keeping one alive may reach further reference objects
+  if (!data.memory_manager.IsNearHeapLimit()) {
+    for (size_t i = 0; i < discovered_references_.size(); ++i) {
+      if (discovered_references_[i].second == ReferenceStrength::kSoft) {
+        Shade(WeakReferenceScanner::Referent(discovered_references_[i].first));
+        DrainGreyObjects(data);
       }
-    });
+    }
   }
+
+  for (const auto& [ref_obj, strength] : discovered_references_) {
+    void*& referent = WeakReferenceScanner::Referent(ref_obj);
+
+    if (referent != nullptr && !(reinterpret_cast<ObjectDescriptor*>(referent)->badge & kMarkBit)) {
+      referent = nullptr;
+    }
+  }
+
+  discovered_references_.clear();
+}
+
+void MarkAndSweepGC::Shade(void* obj) {
+  if (obj == nullptr) {
+    return;
+  }
+
+  auto* desc = reinterpret_cast<ObjectDescriptor*>(obj);
+
+  if (desc->badge & kMarkBit) {
+    return;
+  }
+
+  desc->badge |= kMarkBit;
+  grey_objects_.push_back(obj);
 }
 
 std::expected<void, std::runtime_error> MarkAndSweepGC::Sweep(execution_tree::PassedExecutionData& data) {
   std::vector<void*> to_delete;
+  std::vector<void*> trivial_garbage;
   const ObjectRepository& repo = data.memory_manager.GetRepository();
 
-  repo.ForAll([&to_delete](void* obj) {
+  repo.ForAll([&to_delete, &trivial_garbage, &data](void* obj) {
     auto* desc = reinterpret_cast<ObjectDescriptor*>(obj);
 
     if (!(desc->badge & kMarkBit)) {
-      to_delete.push_back(obj);
+      std::expected<const VirtualTable*, std::runtime_error> vt_res =
+          data.virtual_table_repository.GetByIndex(desc->vtable_index);
+
+      if (vt_res.has_value() && vt_res.value()->IsTriviallyDestructible()) {
+        trivial_garbage.push_back(obj);
+      } else {
+        to_delete.push_back(obj);
+      }
     }
 
     desc->badge &= ~kMarkBit;
   });
 
+  pending_sweep_ = std::move(to_delete);
+
+  // Trivially destructible garbage never runs bytecode, so it is released in bulk even when sweeping lazily
+  std::expected<void, std::runtime_error> trivial_res = data.memory_manager.DeallocateObjects(trivial_garbage, data);
+
+  if (!trivial_res.has_value()) {
+    return trivial_res;
+  }
+
+  if (lazy_sweep_batch_size_ != 0) {
+    return {};
+  }
+
+  return SweepPending(data, pending_sweep_.size());
+}
+
+std::expected<void, std::runtime_error> MarkAndSweepGC::SweepPending(execution_tree::PassedExecutionData& data,
+                                                                     size_t max_objects) {
   std::optional<std::runtime_error> first_error;
 
-  for (void* obj : to_delete) {
+  for (size_t i = 0; i < max_objects && !pending_sweep_.empty(); ++i) {
+    void* obj = pending_sweep_.back();
+    pending_sweep_.pop_back();
+
     std::expected<void, std::runtime_error> dealloc_res = data.memory_manager.DeallocateObject(obj, data);
 
     if (!dealloc_res.has_value() && !first_error) {
@@ -84,44 +263,16 @@ std::expected<void, std::runtime_error> MarkAndSweepGC::Sweep(execution_tree::Pa
   return {};
 }
 
-void MarkAndSweepGC::AddRoots(std::queue<void*>& worklist, execution_tree::PassedExecutionData& data) {
-  AddAllVariables(worklist, data.memory.global_variables);
-
-  // Note that there is no way to traverse a std::stack without emptying it, so we need to create a temporary stack.
-  std::stack<StackFrame> temp_stack_frames = data.memory.stack_frames;
-
-  while (!temp_stack_frames.empty()) {
-    const StackFrame& frame = temp_stack_frames.top();
-    AddAllVariables(worklist, frame.local_variables);
-    temp_stack_frames.pop();
-  }
-
-  AddAllVariables(worklist, data.memory.machine_stack);
-}
-
-void MarkAndSweepGC::AddAllVariables(std::queue<void*>& worklist, const std::vector<Variable>& variables) {
-  for (const Variable& var : variables) {
-    AddRoot(worklist, var);
-  }
-}
-
-void MarkAndSweepGC::AddAllVariables(std::queue<void*>& worklist, VariableStack variables) {
-  while (!variables.empty()) {
-    AddRoot(worklist, variables.top());
-    variables.pop();
-  }
+void MarkAndSweepGC::AddRoots(execution_tree::PassedExecutionData& data) {
+  data.memory.ForEachRoot([this](const Variable& var) { AddRoot(var); });
 }
 
-void MarkAndSweepGC::AddRoot(std::queue<void*>& worklist, const Variable& var) {
+void MarkAndSweepGC::AddRoot(const Variable& var) {
   if (!std::holds_alternative<void*>(var)) {
     return;
   }
 
-  void* ptr = std::get<void*>(var);
-
-  if (ptr) {
-    worklist.push(ptr);
-  }
+  Shade(std::get<void*>(var));
 }
 
 } // namespace ovum::vm::runtime
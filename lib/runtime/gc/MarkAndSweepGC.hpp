@@ -1,26 +1,59 @@
 #ifndef RUNTIME_MARKANDSWEEPGC_HPP
 #define RUNTIME_MARKANDSWEEPGC_HPP
 
-#include <queue>
+#include <chrono>
+#include <cstddef>
+#include <utility>
 #include <vector>
 
 #include "lib/runtime/Variable.hpp"
+#include "lib/runtime/VirtualTable.hpp"
 #include "lib/runtime/gc/IGarbageCollector.hpp"
 
 namespace ovum::vm::runtime {
 
 class MarkAndSweepGC : public IGarbageCollector {
 public:
+  MarkAndSweepGC() = default;
+
+  // A non-zero batch size makes the pause mark only; unmarked objects are then reclaimed lazily,
+  // at most lazy_sweep_batch_size objects per step.
+  // A non-zero mark slice budget makes marking incremental: each step traces grey objects for at most that long.
+  explicit MarkAndSweepGC(size_t lazy_sweep_batch_size,
+                          std::chrono::microseconds mark_slice_budget = std::chrono::microseconds::zero());
+
   std::expected<void, std::runtime_error> Collect(execution_tree::PassedExecutionData& data) override;
+  std::expected<void, std::runtime_error> BeginCollection(execution_tree::PassedExecutionData& data) override;
+  std::expected<void, std::runtime_error> Step(execution_tree::PassedExecutionData& data) override;
+  std::expected<void, std::runtime_error> AllocationStep(execution_tree::PassedExecutionData& data) override;
+  std::expected<void, std::runtime_error> FinishSweep(execution_tree::PassedExecutionData& data) override;
+  [[nodiscard]] bool HasPendingWork() const override;
+  [[nodiscard]] bool IsMarking() const override;
+  void WriteBarrier(void* ref) override;
+  void Reset() override;
 
 private:
-  static void Mark(execution_tree::PassedExecutionData& data);
-  static std::expected<void, std::runtime_error> Sweep(execution_tree::PassedExecutionData& data);
-
-  static void AddRoots(std::queue<void*>& worklist, execution_tree::PassedExecutionData& data);
-  static void AddAllVariables(std::queue<void*>& worklist, const std::vector<Variable>& variables);
-  static void AddAllVariables(std::queue<void*>& worklist, VariableStack variables);
-  static void AddRoot(std::queue<void*>& worklist, const Variable& var);
+  std::expected<void, std::runtime_error> StartMarking(execution_tree::PassedExecutionData& data);
+  bool MarkSlice(execution_tree::PassedExecutionData& data);
+  std::expected<void, std::runtime_error> FinishMarking(execution_tree::PassedExecutionData& data);
+  void ScanObject(void* obj, execution_tree::PassedExecutionData& data);
+  void Shade(void* obj);
+  void DrainGreyObjects(execution_tree::PassedExecutionData& data);
+  void ProcessReferences(execution_tree::PassedExecutionData& data);
+
+  std::expected<void, std::runtime_error> Sweep(execution_tree::PassedExecutionData& data);
+  std::expected<void, std::runtime_error> SweepPending(execution_tree::PassedExecutionData& data, size_t max_objects);
+
+  void AddRoots(execution_tree::PassedExecutionData& data);
+  void AddRoot(const Variable& var);
+
+  size_t lazy_sweep_batch_size_ = 0;
+  std::chrono::microseconds mark_slice_budget_ = std::chrono::microseconds::zero();
+  bool marking_ = false;
+  std::vector<void*> grey_objects_;
+  // WeakRef and SoftRef objects reached during the current mark, processed once marking is done
+  std::vector<std::pair<void*, ReferenceStrength>> discovered_references_;
+  std::vector<void*> pending_sweep_;
 };
 
 } // namespace ovum::vm::runtime
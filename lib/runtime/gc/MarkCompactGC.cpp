@@ -0,0 +1,280 @@
+#include "MarkCompactGC.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "lib/execution_tree/PassedExecutionData.hpp"
+#include "lib/runtime/ObjectDescriptor.hpp"
+#include "lib/runtime/VirtualTableRepository.hpp"
+
+namespace ovum::vm::runtime {
+
+namespace {
+
+struct ObjectMove {
+  void* from;
+  void* to;
+  size_t size;
+};
+
+} // namespace
+
+MarkCompactGC::MarkCompactGC(size_t arena_size, double fragmentation_threshold, size_t compaction_interval) :
+    MarkCompactGC(arena_size, 0, std::chrono::microseconds::zero(), fragmentation_threshold, compaction_interval) {
+}
+
+MarkCompactGC::MarkCompactGC(size_t arena_size,
+                             size_t lazy_sweep_batch_size,
+                             std::chrono::microseconds mark_slice_budget,
+                             double fragmentation_threshold,
+                             size_t compaction_interval) :
+    marker_(lazy_sweep_batch_size, mark_slice_budget),
+    arena_(arena_size), arena_size_(arena_size),
+    fragmentation_threshold_(fragmentation_threshold), compaction_interval_(compaction_interval) {
+}
+
+std::expected<void, std::runtime_error> MarkCompactGC::Collect(execution_tree::PassedExecutionData& data) {
+  cycle_open_ = true;
+  std::expected<void, std::runtime_error> collect_res = marker_.Collect(data);
+
+  if (!collect_res.has_value()) {
+    return collect_res;
+  }
+
+  return FinishCycle(data);
+}
+
+std::expected<void, std::runtime_error> MarkCompactGC::BeginCollection(execution_tree::PassedExecutionData& data) {
+  cycle_open_ = true;
+  std::expected<void, std::runtime_error> begin_res = marker_.BeginCollection(data);
+
+  if (!begin_res.has_value()) {
+    return begin_res;
+  }
+
+  return FinishCycle(data);
+}
+
+std::expected<void, std::runtime_error> MarkCompactGC::Step(execution_tree::PassedExecutionData& data) {
+  std::expected<void, std::runtime_error> step_res = marker_.Step(data);
+
+  if (!step_res.has_value()) {
+    return step_res;
+  }
+
+  return FinishCycle(data);
+}
+
+std::expected<void, std::runtime_error> MarkCompactGC::AllocationStep(execution_tree::PassedExecutionData& data) {
+  // Objects held only by the allocating command would not have their references updated, so a cycle finished here
+  // is compacted at the next safepoint
+  return marker_.AllocationStep(data);
+}
+
+std::expected<void, std::runtime_error> MarkCompactGC::FinishSweep(execution_tree::PassedExecutionData& data) {
+  return marker_.FinishSweep(data);
+}
+
+bool MarkCompactGC::HasPendingWork() const {
+  return cycle_open_ || marker_.HasPendingWork();
+}
+
+bool MarkCompactGC::IsMarking() const {
+  return marker_.IsMarking();
+}
+
+void MarkCompactGC::WriteBarrier(void* ref) {
+  marker_.WriteBarrier(ref);
+}
+
+char* MarkCompactGC::AllocateStorage(const VirtualTable& vtable, size_t size) {
+  if (!vtable.IsRelocatable()) {
+    return nullptr;
+  }
+
+  const size_t aligned_size = AlignSize(size);
+
+  if (aligned_size > arena_size_ - top_) {
+    arena_exhausted_ = true;
+    return nullptr;
+  }
+
+  char* storage = arena_.Data() + top_;
+  top_ += aligned_size;
+  touched_top_ = std::max(touched_top_, top_);
+
+  return storage;
+}
+
+bool MarkCompactGC::ReleaseStorage(char* raw, size_t size) {
+  if (!IsInArena(raw)) {
+    return false;
+  }
+
+  dead_bytes_ += AlignSize(size);
+
+  return true;
+}
+
+void MarkCompactGC::Reset() {
+  marker_.Reset();
+  cycle_open_ = false;
+  top_ = 0;
+  DecommitAboveTop();
+  dead_bytes_ = 0;
+  arena_exhausted_ = false;
+  collections_since_compaction_ = 0;
+}
+
+double MarkCompactGC::GetFragmentation() const {
+  if (top_ == 0) {
+    return 0.0;
+  }
+
+  return static_cast<double>(dead_bytes_) / static_cast<double>(top_);
+}
+
+size_t MarkCompactGC::GetCommittedBytes() const {
+  return touched_top_;
+}
+
+std::expected<void, std::runtime_error> MarkCompactGC::FinishCycle(execution_tree::PassedExecutionData& data) {
+  // Objects waiting for a lazy sweep are still in the repository and would be moved as if they were live
+  if (!cycle_open_ || marker_.HasPendingWork()) {
+    return {};
+  }
+
+  cycle_open_ = false;
+  ++collections_since_compaction_;
+
+  if (!ShouldCompact()) {
+    return {};
+  }
+
+  return Compact(data);
+}
+
+bool MarkCompactGC::ShouldCompact() const {
+  if (dead_bytes_ == 0) {
+    return false;
+  }
+
+  return arena_exhausted_ || GetFragmentation() >= fragmentation_threshold_ ||
+         (compaction_interval_ != 0 && collections_since_compaction_ >= compaction_interval_);
+}
+
+std::expected<void, std::runtime_error> MarkCompactGC::Compact(execution_tree::PassedExecutionData& data) {
+  std::vector<void*> arena_objects;
+
+  data.memory_manager.GetRepository().ForAll([this, &arena_objects](void* obj) {
+    if (IsInArena(obj)) {
+      arena_objects.push_back(obj);
+    }
+  });
+
+  std::ranges::sort(arena_objects);
+
+  std::unordered_map<void*, void*> forwarding;
+  std::vector<ObjectMove> moves;
+  char* cursor = arena_.Data();
+  size_t live_bytes = 0;
+
+  for (void* obj : arena_objects) {
+    auto* desc = reinterpret_cast<ObjectDescriptor*>(obj);
+    std::expected<const VirtualTable*, std::runtime_error> vt_res =
+        data.virtual_table_repository.GetByIndex(desc->vtable_index);
+
+    if (!vt_res.has_value()) {
+      return std::unexpected(vt_res.error());
+    }
+
+    const size_t size = vt_res.value()->GetSize();
+    const size_t aligned_size = AlignSize(size);
+    live_bytes += aligned_size;
+
+    if (data.memory_manager.IsPinned(obj)) {
+      cursor = reinterpret_cast<char*>(obj) + aligned_size;
+      continue;
+    }
+
+    if (obj != cursor) {
+      forwarding.emplace(obj, cursor);
+      moves.push_back({.from = obj, .to = cursor, .size = size});
+    }
+
+    cursor += aligned_size;
+  }
+
+  if (!forwarding.empty()) {
+    ReferenceUpdater updater = [&forwarding](void* ref) -> void* {
+      auto it = forwarding.find(ref);
+      return it == forwarding.end() ? ref : it->second;
+    };
+
+    UpdateRoots(data, updater);
+
+    data.memory_manager.GetRepository().ForAll([&data, &updater](void* obj) {
+      auto* desc = reinterpret_cast<ObjectDescriptor*>(obj);
+      std::expected<const VirtualTable*, std::runtime_error> vt_res =
+          data.virtual_table_repository.GetByIndex(desc->vtable_index);
+
+      if (vt_res.has_value()) {
+        vt_res.value()->UpdateReferences(obj, updater);
+      }
+    });
+
+    // Destinations never lie above their sources, so moving in address order does not overwrite live objects
+    for (const ObjectMove& move : moves) {
+      std::expected<void, std::runtime_error> move_res = data.memory_manager.MoveObject(move.from, move.to, move.size);
+
+      if (!move_res.has_value()) {
+        return move_res;
+      }
+    }
+  }
+
+  top_ = static_cast<size_t>(cursor - arena_.Data());
+  dead_bytes_ = top_ - live_bytes;
+  arena_exhausted_ = false;
+  collections_since_compaction_ = 0;
+  DecommitAboveTop();
+
+  return {};
+}
+
+bool MarkCompactGC::IsInArena(const void* ptr) const {
+  const char* raw = static_cast<const char*>(ptr);
+
+  return raw >= arena_.Data() && raw < arena_.Data() + arena_size_;
+}
+
+void MarkCompactGC::DecommitAboveTop() {
+  if (touched_top_ <= top_) {
+    return;
+  }
+
+  // Only whole pages are returned, the partial page holding top_ stays committed
+  arena_.Decommit(top_, touched_top_ - top_);
+  touched_top_ = top_;
+}
+
+void MarkCompactGC::UpdateRoots(execution_tree::PassedExecutionData& data, const ReferenceUpdater& updater) {
+  data.memory.ForEachRoot([&updater](Variable& var) { UpdateRoot(var, updater); });
+}
+
+void MarkCompactGC::UpdateRoot(Variable& var, const ReferenceUpdater& updater) {
+  if (std::holds_alternative<void*>(var)) {
+    var = updater(std::get<void*>(var));
+  }
+}
+
+size_t MarkCompactGC::AlignSize(size_t size) {
+  constexpr size_t kAlignment = alignof(std::max_align_t);
+
+  return (size + kAlignment - 1) / kAlignment * kAlignment;
+}
+
+} // namespace ovum::vm::runtime
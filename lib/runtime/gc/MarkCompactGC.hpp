@@ -0,0 +1,76 @@
+#ifndef RUNTIME_MARKCOMPACTGC_HPP
+#define RUNTIME_MARKCOMPACTGC_HPP
+
+#include <chrono>
+#include <cstddef>
+
+#include "lib/runtime/Variable.hpp"
+#include "lib/runtime/gc/IGarbageCollector.hpp"
+#include "lib/runtime/gc/MarkAndSweepGC.hpp"
+#include "lib/runtime/gc/ReservedRegion.hpp"
+#include "lib/runtime/gc/reference_scanners/IReferenceScanner.hpp"
+
+namespace ovum::vm::runtime {
+
+// Allocates relocatable objects from a bump-pointer arena and slides live objects together once freed holes make up
+// too large a share of it. Objects that are pinned, not relocatable or that did not fit into the arena are never
+// moved. The arena is reserved address space: pages are committed when first used and the ones freed by compaction are
+// returned to the OS. Marking and sweeping may be lazy or incremental as in MarkAndSweepGC; compaction only runs at
+// a safepoint once a cycle, including its lazy sweep, has finished.
+class MarkCompactGC : public IGarbageCollector {
+public:
+  static constexpr double kDefaultFragmentationThreshold = 0.25;
+  static constexpr size_t kDefaultCompactionInterval = 16;
+
+  explicit MarkCompactGC(size_t arena_size,
+                         double fragmentation_threshold = kDefaultFragmentationThreshold,
+                         size_t compaction_interval = kDefaultCompactionInterval);
+  MarkCompactGC(size_t arena_size,
+                size_t lazy_sweep_batch_size,
+                std::chrono::microseconds mark_slice_budget,
+                double fragmentation_threshold = kDefaultFragmentationThreshold,
+                size_t compaction_interval = kDefaultCompactionInterval);
+
+  std::expected<void, std::runtime_error> Collect(execution_tree::PassedExecutionData& data) override;
+  std::expected<void, std::runtime_error> BeginCollection(execution_tree::PassedExecutionData& data) override;
+  std::expected<void, std::runtime_error> Step(execution_tree::PassedExecutionData& data) override;
+  std::expected<void, std::runtime_error> AllocationStep(execution_tree::PassedExecutionData& data) override;
+  std::expected<void, std::runtime_error> FinishSweep(execution_tree::PassedExecutionData& data) override;
+  [[nodiscard]] bool HasPendingWork() const override;
+  [[nodiscard]] bool IsMarking() const override;
+  void WriteBarrier(void* ref) override;
+  char* AllocateStorage(const VirtualTable& vtable, size_t size) override;
+  bool ReleaseStorage(char* raw, size_t size) override;
+  void Reset() override;
+
+  [[nodiscard]] double GetFragmentation() const;
+  // Bytes of the arena that may be backed by memory, i.e. touched since they were last returned to the OS
+  [[nodiscard]] size_t GetCommittedBytes() const;
+
+private:
+  std::expected<void, std::runtime_error> FinishCycle(execution_tree::PassedExecutionData& data);
+  [[nodiscard]] bool ShouldCompact() const;
+  std::expected<void, std::runtime_error> Compact(execution_tree::PassedExecutionData& data);
+  [[nodiscard]] bool IsInArena(const void* ptr) const;
+  void DecommitAboveTop();
+
+  static void UpdateRoots(execution_tree::PassedExecutionData& data, const ReferenceUpdater& updater);
+  static void UpdateRoot(Variable& var, const ReferenceUpdater& updater);
+  static size_t AlignSize(size_t size);
+
+  MarkAndSweepGC marker_;
+  ReservedRegion arena_;
+  size_t arena_size_;
+  size_t top_ = 0;
+  size_t touched_top_ = 0;
+  size_t dead_bytes_ = 0;
+  bool arena_exhausted_ = false;
+  double fragmentation_threshold_;
+  size_t compaction_interval_;
+  size_t collections_since_compaction_ = 0;
+  bool cycle_open_ = false;
+};
+
+} // namespace ovum::vm::runtime
+
+#endif // RUNTIME_MARKCOMPACTGC_HPP
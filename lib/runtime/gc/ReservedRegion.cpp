@@ -0,0 +1,85 @@
+#include "ReservedRegion.hpp"
+
+#include <new>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace ovum::vm::runtime {
+
+ReservedRegion::ReservedRegion(size_t size) : data_(nullptr), size_(size) {
+  if (size_ == 0) {
+    return;
+  }
+
+#ifdef _WIN32
+  void* data = VirtualAlloc(nullptr, size_, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+
+  if (data == nullptr) {
+    throw std::bad_alloc();
+  }
+#else
+  void* data = mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+
+  if (data == MAP_FAILED) {
+    throw std::bad_alloc();
+  }
+#endif
+
+  data_ = static_cast<char*>(data);
+}
+
+ReservedRegion::~ReservedRegion() {
+  if (data_ == nullptr) {
+    return;
+  }
+
+#ifdef _WIN32
+  VirtualFree(data_, 0, MEM_RELEASE);
+#else
+  munmap(data_, size_);
+#endif
+}
+
+char* ReservedRegion::Data() const {
+  return data_;
+}
+
+size_t ReservedRegion::Size() const {
+  return size_;
+}
+
+size_t ReservedRegion::Decommit(size_t offset, size_t length) {
+  const size_t page_size = GetPageSize();
+  const size_t begin = (offset + page_size - 1) / page_size * page_size;
+  const size_t end = (offset + length) / page_size * page_size;
+
+  if (data_ == nullptr || end <= begin) {
+    return 0;
+  }
+
+#ifdef _WIN32
+  VirtualFree(data_ + begin, end - begin, MEM_DECOMMIT);
+  VirtualAlloc(data_ + begin, end - begin, MEM_COMMIT, PAGE_READWRITE);
+#else
+  madvise(data_ + begin, end - begin, MADV_DONTNEED);
+#endif
+
+  return end - begin;
+}
+
+size_t ReservedRegion::GetPageSize() {
+#ifdef _WIN32
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  return info.dwPageSize;
+#else
+  return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+} // namespace ovum::vm::runtime
@@ -0,0 +1,33 @@
+#ifndef RUNTIME_RESERVEDREGION_HPP
+#define RUNTIME_RESERVEDREGION_HPP
+
+#include <cstddef>
+
+namespace ovum::vm::runtime {
+
+// A contiguous range of address space reserved up front. Pages are committed by the OS on first touch and can be
+// handed back with Decommit, after which they read as zero again.
+class ReservedRegion {
+public:
+  explicit ReservedRegion(size_t size);
+  ~ReservedRegion();
+
+  ReservedRegion(const ReservedRegion&) = delete;
+  ReservedRegion& operator=(const ReservedRegion&) = delete;
+
+  [[nodiscard]] char* Data() const;
+  [[nodiscard]] size_t Size() const;
+
+  // Returns the whole pages inside [offset, offset + length) to the OS and reports how many bytes that was
+  size_t Decommit(size_t offset, size_t length);
+
+  [[nodiscard]] static size_t GetPageSize();
+
+private:
+  char* data_;
+  size_t size_;
+};
+
+} // namespace ovum::vm::runtime
+
+#endif // RUNTIME_RESERVEDREGION_HPP
@@ -6,7 +6,7 @@
 
 namespace ovum::vm::runtime {
 
-void ArrayReferenceScanner::Scan(void* obj, const std::vector<FieldInfo>&, const ReferenceVisitor& visitor) const {
+void ArrayReferenceScanner::Scan(void* obj, const std::vector<int64_t>&, const ReferenceVisitor& visitor) const {
   const char* base = reinterpret_cast<const char*>(obj) + sizeof(ObjectDescriptor);
   const std::vector<void*>& vec = *reinterpret_cast<const std::vector<void*>*>(base);
 
@@ -15,4 +15,15 @@ void ArrayReferenceScanner::Scan(void* obj, const std::vector<FieldInfo>&, const
   }
 }
 
+void ArrayReferenceScanner::UpdateReferences(void* obj,
+                                             const std::vector<int64_t>&,
+                                             const ReferenceUpdater& updater) const {
+  char* base = reinterpret_cast<char*>(obj) + sizeof(ObjectDescriptor);
+  std::vector<void*>& vec = *reinterpret_cast<std::vector<void*>*>(base);
+
+  for (void*& p : vec) {
+    p = updater(p);
+  }
+}
+
 } // namespace ovum::vm::runtime
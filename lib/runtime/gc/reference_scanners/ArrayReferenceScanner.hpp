@@ -7,7 +7,10 @@ namespace ovum::vm::runtime {
 
 class ArrayReferenceScanner : public IReferenceScanner {
 public:
-  void Scan(void* obj, const std::vector<FieldInfo>& fields, const ReferenceVisitor& visitor) const override;
+  void Scan(void* obj, const std::vector<int64_t>& reference_offsets, const ReferenceVisitor& visitor) const override;
+  void UpdateReferences(void* obj,
+                        const std::vector<int64_t>& reference_offsets,
+                        const ReferenceUpdater& updater) const override;
 };
 
 } // namespace ovum::vm::runtime
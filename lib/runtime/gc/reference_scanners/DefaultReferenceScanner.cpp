@@ -1,24 +1,27 @@
-
 #include "DefaultReferenceScanner.hpp"
 
 #include <vector>
 
-#include "lib/runtime/FieldInfo.hpp"
-#include "lib/runtime/Variable.hpp"
-
 namespace ovum::vm::runtime {
 
 void DefaultReferenceScanner::Scan(void* obj,
-                                   const std::vector<FieldInfo>& fields,
+                                   const std::vector<int64_t>& reference_offsets,
                                    const ReferenceVisitor& visitor) const {
-  for (const FieldInfo& field : fields) {
-    const Variable& var = field.variable_accessor->GetVariable(reinterpret_cast<char*>(obj) + field.offset);
+  char* base = reinterpret_cast<char*>(obj);
+
+  for (int64_t offset : reference_offsets) {
+    visitor(*reinterpret_cast<void**>(base + offset));
+  }
+}
 
-    if (!std::holds_alternative<void*>(var)) {
-      continue;
-    }
+void DefaultReferenceScanner::UpdateReferences(void* obj,
+                                               const std::vector<int64_t>& reference_offsets,
+                                               const ReferenceUpdater& updater) const {
+  char* base = reinterpret_cast<char*>(obj);
 
-    visitor(std::get<void*>(var));
+  for (int64_t offset : reference_offsets) {
+    void*& slot = *reinterpret_cast<void**>(base + offset);
+    slot = updater(slot);
   }
 }
 
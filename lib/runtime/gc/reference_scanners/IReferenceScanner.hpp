@@ -1,19 +1,25 @@
 #ifndef RUNTIME_IREFERENCESCANNER_HPP
 #define RUNTIME_IREFERENCESCANNER_HPP
 
+#include <cstdint>
 #include <functional>
 #include <vector>
 
-#include "lib/runtime/FieldInfo.hpp"
-
 namespace ovum::vm::runtime {
 
 using ReferenceVisitor = std::function<void(void*)>;
+using ReferenceUpdater = std::function<void*(void*)>;
 
+// Scanners receive the byte offsets of the reference-typed fields, precomputed by the VirtualTable
 class IReferenceScanner { // NOLINT(cppcoreguidelines-special-member-functions)
 public:
   virtual ~IReferenceScanner() = default;
-  virtual void Scan(void* obj, const std::vector<FieldInfo>& fields, const ReferenceVisitor& visitor) const = 0;
+  virtual void Scan(void* obj,
+                    const std::vector<int64_t>& reference_offsets,
+                    const ReferenceVisitor& visitor) const = 0;
+  virtual void UpdateReferences(void* obj,
+                                const std::vector<int64_t>& reference_offsets,
+                                const ReferenceUpdater& updater) const = 0;
 };
 
 } // namespace ovum::vm::runtime
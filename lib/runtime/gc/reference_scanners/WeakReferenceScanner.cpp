@@ -0,0 +1,26 @@
+#include "WeakReferenceScanner.hpp"
+
+#include <vector>
+
+#include "lib/runtime/ObjectDescriptor.hpp"
+
+namespace ovum::vm::runtime {
+
+void WeakReferenceScanner::Scan(void*, const std::vector<int64_t>&, const ReferenceVisitor&) const {
+}
+
+void WeakReferenceScanner::UpdateReferences(void* obj,
+                                            const std::vector<int64_t>&,
+                                            const ReferenceUpdater& updater) const {
+  void*& referent = Referent(obj);
+
+  if (referent != nullptr) {
+    referent = updater(referent);
+  }
+}
+
+void*& WeakReferenceScanner::Referent(void* obj) {
+  return *reinterpret_cast<void**>(reinterpret_cast<char*>(obj) + sizeof(ObjectDescriptor));
+}
+
+} // namespace ovum::vm::runtime
@@ -0,0 +1,22 @@
+#ifndef RUNTIME_WEAKREFERENCESCANNER_HPP
+#define RUNTIME_WEAKREFERENCESCANNER_HPP
+
+#include "IReferenceScanner.hpp"
+
+namespace ovum::vm::runtime {
+
+// Scanner for WeakRef and SoftRef objects: the referent right after the descriptor is not traced, the collector
+// decides after marking whether to keep or clear it. A compacting collector still relocates it.
+class WeakReferenceScanner : public IReferenceScanner {
+public:
+  void Scan(void* obj, const std::vector<int64_t>& reference_offsets, const ReferenceVisitor& visitor) const override;
+  void UpdateReferences(void* obj,
+                        const std::vector<int64_t>& reference_offsets,
+                        const ReferenceUpdater& updater) const override;
+
+  static void*& Referent(void* obj);
+};
+
+} // namespace ovum::vm::runtime
+
+#endif // RUNTIME_WEAKREFERENCESCANNER_HPP
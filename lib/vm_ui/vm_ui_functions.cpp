@@ -1,5 +1,6 @@
 #include "vm_ui_functions.hpp"
 
+#include <chrono>
 #include <cstddef>
 #include <filesystem>
 #include <fstream>
@@ -16,16 +17,24 @@
 #include "lib/executor/Executor.hpp"
 #include "lib/executor/IJitExecutorFactory.hpp"
 #include "lib/executor/builtin_factory.hpp"
+#include "lib/runtime/HeapSizing.hpp"
 #include "lib/runtime/RuntimeMemory.hpp"
 #include "lib/runtime/VirtualTableRepository.hpp"
 #include "lib/runtime/gc/MarkAndSweepGC.hpp"
+#include "lib/runtime/gc/MarkCompactGC.hpp"
 
 #ifdef JIT_PROVIDED
 #include <jit/JitExecutorFactory.hpp>
 #endif
 
 constexpr size_t kDefaultJitBoundary = 100000;
-constexpr size_t kDefaultMaxObjects = 10000;
+constexpr size_t kDefaultGcInitialHeap = ovum::vm::runtime::HeapSizing::kDefaultInitialHeapBytes;
+constexpr size_t kDefaultGcGrowthPercent = 200;
+constexpr size_t kDefaultGcMaxHeap = 0;
+constexpr double kPercent = 100.0;
+constexpr size_t kDefaultGcSweepBatch = 0;
+constexpr size_t kDefaultGcSliceUs = 0;
+constexpr size_t kDefaultGcCompactArena = 0;
 
 std::string ReadFileContent(const std::string& file_path, std::ostream& err) {
   std::ifstream file(file_path);
@@ -39,6 +48,31 @@ std::string ReadFileContent(const std::string& file_path, std::ostream& err) {
   return buffer.str();
 }
 
+void PrintFusedAllocations(const std::vector<ovum::bytecode::parser::FusedAllocation>& sites, std::ostream& out) {
+  out << "Fused " << sites.size() << " allocation site(s) with their consumer\n";
+
+  for (const ovum::bytecode::parser::FusedAllocation& site : sites) {
+    const std::string& function_name = site.function_name.empty() ? std::string("<init-static>") : site.function_name;
+    out << "  " << function_name << " line " << site.line << ": " << site.allocation << " consumed by "
+        << site.consumer << "\n";
+  }
+}
+
+void PrintPackedLayouts(const std::vector<ovum::bytecode::parser::PackedClassLayout>& layouts, std::ostream& out) {
+  size_t saved_bytes = 0;
+
+  for (const ovum::bytecode::parser::PackedClassLayout& layout : layouts) {
+    saved_bytes += layout.declared_size - layout.packed_size;
+  }
+
+  out << "Field layout packing shrank " << layouts.size() << " class(es) by " << saved_bytes << " byte(s) per object\n";
+
+  for (const ovum::bytecode::parser::PackedClassLayout& layout : layouts) {
+    out << "  " << layout.class_name << ": " << layout.field_count << " field(s), " << layout.declared_size << " -> "
+        << layout.packed_size << " bytes, saves " << layout.declared_size - layout.packed_size << "\n";
+  }
+}
+
 int32_t StartVmConsoleUI(const std::vector<std::string>& args, std::ostream& out, std::istream& in, std::ostream& err) {
   size_t separator_index = args.size();
   for (size_t i = 1; i < args.size(); ++i) {
@@ -64,8 +98,22 @@ int32_t StartVmConsoleUI(const std::vector<std::string>& args, std::ostream& out
   ArgumentParser::ArgParser arg_parser("ovum-vm", PassArgumentTypes());
   arg_parser.AddCompositeArgument('f', "file", "Path to the bytecode file").AddIsGood(is_file).AddValidate(is_file);
   arg_parser.AddUnsignedLongLongArgument('j', "jit-boundary", "JIT compilation boundary").Default(kDefaultJitBoundary);
-  arg_parser.AddUnsignedLongLongArgument('m', "max-objects", "Maximum number of objects to keep in memory")
-      .Default(kDefaultMaxObjects);
+  arg_parser.AddUnsignedLongLongArgument('i', "gc-initial-heap", "Heap bytes that trigger the first GC")
+      .Default(kDefaultGcInitialHeap);
+  arg_parser.AddUnsignedLongLongArgument('g', "gc-growth-percent", "Heap target after GC, percent of live bytes")
+      .Default(kDefaultGcGrowthPercent);
+  arg_parser.AddUnsignedLongLongArgument('m', "gc-max-heap", "Hard heap limit in bytes, 0 for no limit")
+      .Default(kDefaultGcMaxHeap);
+  arg_parser.AddUnsignedLongLongArgument('s', "gc-sweep-batch", "Objects swept per lazy GC step, 0 for eager sweep")
+      .Default(kDefaultGcSweepBatch);
+  arg_parser.AddUnsignedLongLongArgument('u', "gc-slice-us", "Incremental marking slice in microseconds, 0 to disable")
+      .Default(kDefaultGcSliceUs);
+  arg_parser.AddUnsignedLongLongArgument('c', "gc-compact-arena", "Compacting heap size in bytes, 0 to disable")
+      .Default(kDefaultGcCompactArena);
+  arg_parser.AddFlag('r', "fusion-report", "Print allocations fused with the command that consumes them");
+  arg_parser.AddFlag('p', "pack-fields", "Reorder user class fields by alignment to remove padding");
+  arg_parser.AddFlag('l', "layout-report", "Print per-class object size savings of --pack-fields");
+  arg_parser.AddFlag('t', "fast-teardown", "At exit run only destructors that release non-memory resources");
   arg_parser.AddHelp('h', "help", description);
 
   bool parse_result = arg_parser.Parse(parser_args, {.out_stream = err, .print_messages = true});
@@ -83,7 +131,13 @@ int32_t StartVmConsoleUI(const std::vector<std::string>& args, std::ostream& out
   file_path = arg_parser.GetCompositeValue("file");
 
   size_t jit_boundary = arg_parser.GetUnsignedLongLongValue("jit-boundary");
-  size_t max_objects = arg_parser.GetUnsignedLongLongValue("max-objects");
+  ovum::vm::runtime::HeapSizing heap_sizing{
+      .initial_heap_bytes = arg_parser.GetUnsignedLongLongValue("gc-initial-heap"),
+      .growth_factor = static_cast<double>(arg_parser.GetUnsignedLongLongValue("gc-growth-percent")) / kPercent,
+      .max_heap_bytes = arg_parser.GetUnsignedLongLongValue("gc-max-heap")};
+  size_t gc_sweep_batch = arg_parser.GetUnsignedLongLongValue("gc-sweep-batch");
+  std::chrono::microseconds gc_slice(arg_parser.GetUnsignedLongLongValue("gc-slice-us"));
+  size_t gc_compact_arena = arg_parser.GetUnsignedLongLongValue("gc-compact-arena");
   std::string sample = ReadFileContent(file_path, err);
 
   if (sample.empty()) {
@@ -95,7 +149,15 @@ int32_t StartVmConsoleUI(const std::vector<std::string>& args, std::ostream& out
   ovum::vm::execution_tree::FunctionRepository func_repo;
   ovum::vm::runtime::VirtualTableRepository vtable_repo;
   ovum::vm::runtime::RuntimeMemory memory;
-  ovum::vm::runtime::MemoryManager memory_manager(std::make_unique<ovum::vm::runtime::MarkAndSweepGC>(), max_objects);
+  std::unique_ptr<ovum::vm::runtime::IGarbageCollector> gc;
+
+  if (gc_compact_arena > 0) {
+    gc = std::make_unique<ovum::vm::runtime::MarkCompactGC>(gc_compact_arena, gc_sweep_batch, gc_slice);
+  } else {
+    gc = std::make_unique<ovum::vm::runtime::MarkAndSweepGC>(gc_sweep_batch, gc_slice);
+  }
+
+  ovum::vm::runtime::MemoryManager memory_manager(std::move(gc), heap_sizing);
   ovum::vm::execution_tree::PassedExecutionData execution_data{.memory = memory,
                                                                .virtual_table_repository = vtable_repo,
                                                                .function_repository = func_repo,
@@ -120,7 +182,8 @@ int32_t StartVmConsoleUI(const std::vector<std::string>& args, std::ostream& out
 #endif
 
     ovum::bytecode::parser::CommandFactory command_factory = ovum::bytecode::parser::CommandFactory();
-    ovum::bytecode::parser::BytecodeParser bytecode_parser(std::move(jit_factory), jit_boundary, command_factory);
+    ovum::bytecode::parser::BytecodeParser bytecode_parser(
+        std::move(jit_factory), jit_boundary, command_factory, arg_parser.GetFlag("pack-fields"));
 
     auto vtable_result = ovum::vm::runtime::RegisterBuiltinVirtualTables(vtable_repo);
     if (!vtable_result) {
@@ -134,12 +197,20 @@ int32_t StartVmConsoleUI(const std::vector<std::string>& args, std::ostream& out
     }
 
     const std::vector<ovum::TokenPtr>& tokens = toks.value();
-    auto result = bytecode_parser.Parse(tokens, func_repo, vtable_repo, memory);
+    auto result = bytecode_parser.Parse(tokens, func_repo, vtable_repo, memory, memory_manager.GetStringPool());
 
     if (!result) {
       throw result.error();
     }
 
+    if (arg_parser.GetFlag("fusion-report")) {
+      PrintFusedAllocations(bytecode_parser.GetFusedAllocations(), err);
+    }
+
+    if (arg_parser.GetFlag("layout-report")) {
+      PrintPackedLayouts(bytecode_parser.GetPackedLayouts(), err);
+    }
+
     ovum::vm::executor::Executor executor(execution_data);
     auto execution_result = executor.RunProgram(result.value(), program_args);
 
@@ -159,7 +230,10 @@ int32_t StartVmConsoleUI(const std::vector<std::string>& args, std::ostream& out
     return_code = 4;
   }
 
-  auto clear_result = memory_manager.Clear(execution_data);
+  ovum::vm::runtime::TeardownMode teardown_mode = arg_parser.GetFlag("fast-teardown")
+                                                      ? ovum::vm::runtime::TeardownMode::kFast
+                                                      : ovum::vm::runtime::TeardownMode::kFull;
+  auto clear_result = memory_manager.Clear(execution_data, teardown_mode);
   if (!clear_result.has_value()) {
     err << "Warning: Failed to clean up objects during shutdown: " << clear_result.error().what() << "\n";
     return_code = 4;
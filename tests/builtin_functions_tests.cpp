@@ -10,8 +10,10 @@
 
 #include "lib/execution_tree/ExecutionResult.hpp"
 #include "lib/executor/BuiltinFunctions.hpp"
+#include "lib/runtime/BuiltinTypes.hpp"
 #include "lib/runtime/ByteArray.hpp"
 #include "lib/runtime/ObjectDescriptor.hpp"
+#include "lib/runtime/String.hpp"
 #include "lib/runtime/Variable.hpp"
 
 namespace {
@@ -126,8 +128,8 @@ TEST_F(BuiltinTestSuite, PrimitiveIntMethods) {
   ASSERT_FALSE(memory_.machine_stack.empty());
   auto string_obj = std::get<void*>(memory_.machine_stack.top());
   memory_.machine_stack.pop();
-  auto* string_data = ovum::vm::runtime::GetDataPointer<std::string>(string_obj);
-  EXPECT_EQ(*string_data, std::to_string(kValue));
+  auto* string_data = ovum::vm::runtime::GetDataPointer<ovum::vm::runtime::String>(string_obj);
+  EXPECT_EQ(string_data->View(), std::to_string(kValue));
 
   auto hash = ExecuteFunction(*this, "_Int_GetHash_<C>", int_obj);
   ASSERT_TRUE(hash.has_value());
@@ -168,8 +170,8 @@ TEST_F(BuiltinTestSuite, PrimitiveFloatCharByteBoolMethods) {
   ASSERT_TRUE(ExecuteFunction(*this, "_Char_ToString_<C>", char_obj).has_value());
   auto char_string = std::get<void*>(memory_.machine_stack.top());
   memory_.machine_stack.pop();
-  auto* char_str_data = ovum::vm::runtime::GetDataPointer<std::string>(char_string);
-  EXPECT_EQ(*char_str_data, std::string(1, kCharValue));
+  auto* char_str_data = ovum::vm::runtime::GetDataPointer<ovum::vm::runtime::String>(char_string);
+  EXPECT_EQ(char_str_data->View(), std::string(1, kCharValue));
   ASSERT_TRUE(ExecuteFunction(*this, "_Char_GetHash_<C>", char_obj).has_value());
   ExpectStackTopEquals<int64_t>(*this, static_cast<int64_t>(std::hash<char>{}(kCharValue)));
 
@@ -181,8 +183,8 @@ TEST_F(BuiltinTestSuite, PrimitiveFloatCharByteBoolMethods) {
   ASSERT_TRUE(ExecuteFunction(*this, "_Byte_ToString_<C>", byte_obj).has_value());
   auto byte_str_obj = std::get<void*>(memory_.machine_stack.top());
   memory_.machine_stack.pop();
-  auto* byte_str = ovum::vm::runtime::GetDataPointer<std::string>(byte_str_obj);
-  EXPECT_EQ(*byte_str, std::to_string(kByteValue));
+  auto* byte_str = ovum::vm::runtime::GetDataPointer<ovum::vm::runtime::String>(byte_str_obj);
+  EXPECT_EQ(byte_str->View(), std::to_string(kByteValue));
   ASSERT_TRUE(ExecuteFunction(*this, "_Byte_GetHash_<C>", byte_obj).has_value());
   ExpectStackTopEquals<int64_t>(*this, static_cast<int64_t>(std::hash<uint8_t>{}(kByteValue)));
 
@@ -209,8 +211,8 @@ TEST_F(BuiltinTestSuite, NullableAndStringMethods) {
   ASSERT_NE(nullable_obj, nullptr);
   void* wrapped_str = AllocateObjectByName(*this, "String");
   ASSERT_NE(wrapped_str, nullptr);
-  auto* str_ptr = ovum::vm::runtime::GetDataPointer<std::string>(wrapped_str);
-  new (str_ptr) std::string(kText);
+  auto* str_ptr = ovum::vm::runtime::GetDataPointer<ovum::vm::runtime::String>(wrapped_str);
+  new (str_ptr) ovum::vm::runtime::String(kText);
 
   ASSERT_TRUE(ExecuteFunction(*this, "_Nullable_Object", nullable_obj, wrapped_str).has_value());
   ExpectStackTopPointer(*this, nullable_obj);
@@ -220,19 +222,20 @@ TEST_F(BuiltinTestSuite, NullableAndStringMethods) {
   // String copy/equals/isLess/hash/length/toUtf8Bytes
   void* string_obj = AllocateObjectByName(*this, "String");
   ASSERT_NE(string_obj, nullptr);
-  new (ovum::vm::runtime::GetDataPointer<std::string>(string_obj)) std::string(kText);
+  new (ovum::vm::runtime::GetDataPointer<ovum::vm::runtime::String>(string_obj)) ovum::vm::runtime::String(kText);
   void* string_copy = AllocateObjectByName(*this, "String");
   ASSERT_NE(string_copy, nullptr);
   ASSERT_TRUE(ExecuteFunction(*this, "_String_String", string_copy, string_obj).has_value());
   ExpectStackTopPointer(*this, string_copy);
-  EXPECT_EQ(*ovum::vm::runtime::GetDataPointer<std::string>(string_copy), kText);
+  EXPECT_EQ(ovum::vm::runtime::GetDataPointer<ovum::vm::runtime::String>(string_copy)->View(), kText);
 
   ASSERT_TRUE(ExecuteFunction(*this, "_String_Equals_<C>_Object", string_copy, string_obj).has_value());
   ExpectStackTopEquals<bool>(*this, true);
 
   void* string_other = AllocateObjectByName(*this, "String");
   ASSERT_NE(string_other, nullptr);
-  new (ovum::vm::runtime::GetDataPointer<std::string>(string_other)) std::string(kOtherText);
+  new (ovum::vm::runtime::GetDataPointer<ovum::vm::runtime::String>(string_other))
+      ovum::vm::runtime::String(kOtherText);
   ASSERT_TRUE(ExecuteFunction(*this, "_String_IsLess_<C>_Object", string_other, string_obj).has_value());
   ExpectStackTopEquals<bool>(*this, kOtherText < kText);
 
@@ -252,6 +255,88 @@ TEST_F(BuiltinTestSuite, NullableAndStringMethods) {
   EXPECT_EQ(std::string(reinterpret_cast<char*>(byte_array->Data())), kText);
 }
 
+TEST_F(BuiltinTestSuite, WeakAndSoftReferences) {
+  void* kept = AllocateObjectByName(*this, "Int");
+  void* dropped = AllocateObjectByName(*this, "Int");
+  void* cached = AllocateObjectByName(*this, "Int");
+  void* weak_kept = AllocateObjectByName(*this, "WeakRef");
+  void* weak_dropped = AllocateObjectByName(*this, "WeakRef");
+  void* soft = AllocateObjectByName(*this, "SoftRef");
+
+  ASSERT_TRUE(ExecuteFunction(*this, "_WeakRef_Object", weak_kept, kept).has_value());
+  ExpectStackTopPointer(*this, weak_kept);
+  ASSERT_TRUE(ExecuteFunction(*this, "_WeakRef_Object", weak_dropped, dropped).has_value());
+  ExpectStackTopPointer(*this, weak_dropped);
+  ASSERT_TRUE(ExecuteFunction(*this, "_SoftRef_Object", soft, cached).has_value());
+  ExpectStackTopPointer(*this, soft);
+
+  memory_.global_variables.emplace_back(kept);
+  memory_.global_variables.emplace_back(weak_kept);
+  memory_.global_variables.emplace_back(weak_dropped);
+  memory_.global_variables.emplace_back(soft);
+
+  ASSERT_TRUE(memory_manager_.CollectGarbage(data_).has_value());
+
+  // Without a heap limit the soft referent is never under pressure
+  ASSERT_TRUE(ExecuteFunction(*this, "_SoftRef_IsAlive_<C>", soft).has_value());
+  ExpectStackTopEquals<bool>(*this, true);
+  ASSERT_TRUE(ExecuteFunction(*this, "_WeakRef_IsAlive_<C>", weak_kept).has_value());
+  ExpectStackTopEquals<bool>(*this, true);
+  ASSERT_TRUE(ExecuteFunction(*this, "_WeakRef_IsAlive_<C>", weak_dropped).has_value());
+  ExpectStackTopEquals<bool>(*this, false);
+
+  ASSERT_TRUE(ExecuteFunction(*this, "_WeakRef_Get_<C>", weak_kept).has_value());
+  EXPECT_EQ(*ovum::vm::runtime::GetDataPointer<void*>(PopObject()), kept);
+  ASSERT_TRUE(ExecuteFunction(*this, "_WeakRef_Get_<C>", weak_dropped).has_value());
+  ExpectTopNullableHasValue(false);
+
+  memory_.global_variables.clear();
+}
+
+TEST_F(BuiltinTestSuite, StringBuilderMethods) {
+  constexpr std::string_view kPiece = "ab";
+  constexpr int64_t kAppendCount = 100000;
+
+  void* builder_obj = AllocateObjectByName(*this, "StringBuilder");
+  ASSERT_NE(builder_obj, nullptr);
+  ASSERT_TRUE(ExecuteFunction(*this, "_StringBuilder", builder_obj).has_value());
+  ExpectStackTopPointer(*this, builder_obj);
+
+  ASSERT_TRUE(ExecuteFunction(*this, "_StringBuilder_Reserve_<M>_int", builder_obj, int64_t{16}).has_value());
+
+  void* piece_obj = AllocateObjectByName(*this, "String");
+  ASSERT_NE(piece_obj, nullptr);
+  new (ovum::vm::runtime::GetDataPointer<ovum::vm::runtime::String>(piece_obj)) ovum::vm::runtime::String(kPiece);
+
+  for (int64_t i = 0; i < kAppendCount; ++i) {
+    ASSERT_TRUE(ExecuteFunction(*this, "_StringBuilder_Append_<M>_String", builder_obj, piece_obj).has_value());
+  }
+
+  ASSERT_TRUE(ExecuteFunction(*this, "_StringBuilder_AppendChar_<M>_char", builder_obj, 'z').has_value());
+
+  const int64_t expected_length = kAppendCount * static_cast<int64_t>(kPiece.size()) + 1;
+  ASSERT_TRUE(ExecuteFunction(*this, "_StringBuilder_Length_<C>", builder_obj).has_value());
+  ExpectStackTopEquals<int64_t>(*this, expected_length);
+
+  ASSERT_TRUE(ExecuteFunction(*this, "_StringBuilder_ToString_<C>", builder_obj).has_value());
+  void* result_obj = std::get<void*>(memory_.machine_stack.top());
+  memory_.machine_stack.pop();
+  const std::string result = ovum::vm::runtime::GetDataPointer<ovum::vm::runtime::String>(result_obj)->ToStdString();
+  ASSERT_EQ(static_cast<int64_t>(result.size()), expected_length);
+  EXPECT_EQ(result.substr(0, kPiece.size()), kPiece);
+  EXPECT_EQ(result.back(), 'z');
+
+  void* builder_copy = AllocateObjectByName(*this, "StringBuilder");
+  ASSERT_NE(builder_copy, nullptr);
+  ASSERT_TRUE(ExecuteFunction(*this, "_StringBuilder_StringBuilder", builder_copy, builder_obj).has_value());
+  ExpectStackTopPointer(*this, builder_copy);
+
+  ASSERT_TRUE(ExecuteFunction(*this, "_StringBuilder_Clear_<M>", builder_obj).has_value());
+  ASSERT_TRUE(ExecuteFunction(*this, "_StringBuilder_Length_<C>", builder_obj).has_value());
+  ExpectStackTopEquals<int64_t>(*this, int64_t{0});
+  EXPECT_EQ(*ovum::vm::runtime::GetDataPointer<std::string>(builder_copy), result);
+}
+
 TEST_F(BuiltinTestSuite, FundamentalArrayMethods) {
   constexpr int64_t kIntDefault = 1;
   constexpr int64_t kIntInsert = 5;
@@ -332,7 +417,7 @@ TEST_F(BuiltinTestSuite, ObjectStringPointerArrayMethods) {
 
   auto make_string_obj = [&](std::string_view text) {
     void* obj = AllocateObjectByName(*this, "String");
-    new (ovum::vm::runtime::GetDataPointer<std::string>(obj)) std::string(text);
+    new (ovum::vm::runtime::GetDataPointer<ovum::vm::runtime::String>(obj)) ovum::vm::runtime::String(text);
     return obj;
   };
 
@@ -361,6 +446,34 @@ TEST_F(BuiltinTestSuite, ObjectStringPointerArrayMethods) {
   ExpectStackTopPointer(*this, another_str);
 }
 
+TEST_F(BuiltinTestSuite, BuiltinTypesRecordRegisteredIndices) {
+  const ovum::vm::runtime::BuiltinTypes& builtin_types = vtable_repo_.GetBuiltinTypes();
+
+  for (auto type : {ovum::vm::runtime::BuiltinType::kString,
+                    ovum::vm::runtime::BuiltinType::kNullable,
+                    ovum::vm::runtime::BuiltinType::kByteArray,
+                    ovum::vm::runtime::BuiltinType::kStringArray,
+                    ovum::vm::runtime::BuiltinType::kFile,
+                    ovum::vm::runtime::BuiltinType::kInt}) {
+    auto index = builtin_types.GetIndex(type);
+    ASSERT_TRUE(index.has_value()) << ovum::vm::runtime::BuiltinTypes::GetName(type);
+    EXPECT_EQ(index.value(), vtable_repo_.GetIndexByName(ovum::vm::runtime::BuiltinTypes::GetName(type)).value());
+  }
+
+  EXPECT_FALSE(ovum::vm::runtime::BuiltinTypes().GetIndex(ovum::vm::runtime::BuiltinType::kString).has_value());
+
+  auto string_obj = ovum::vm::runtime::AllocateBuiltin<ovum::vm::runtime::String>(
+      data_, ovum::vm::runtime::BuiltinType::kString, std::string(64, 'x'));
+  ASSERT_TRUE(string_obj.has_value());
+  EXPECT_EQ(reinterpret_cast<ovum::vm::runtime::ObjectDescriptor*>(string_obj.value())->vtable_index,
+            vtable_repo_.GetIndexByName("String").value());
+  EXPECT_EQ(ovum::vm::runtime::GetDataPointer<ovum::vm::runtime::String>(string_obj.value())->ToStdString(),
+            std::string(64, 'x'));
+  EXPECT_EQ(memory_manager_.GetExternalBytes(),
+            ovum::vm::runtime::ExternalBytes(
+                *ovum::vm::runtime::GetDataPointer<ovum::vm::runtime::String>(string_obj.value())));
+}
+
 TEST_F(BuiltinTestSuite, ByteArrayOperations) {
   constexpr int64_t kSize = 3;
   constexpr uint8_t kDefaultByte = 0x01;
@@ -461,9 +574,11 @@ TEST_F(BuiltinTestSuite, FileMethods) {
   ExpectStackTopPointer(*this, file_obj);
 
   void* path_obj = AllocateObjectByName(*this, "String");
-  new (ovum::vm::runtime::GetDataPointer<std::string>(path_obj)) std::string(temp_path.string());
+  new (ovum::vm::runtime::GetDataPointer<ovum::vm::runtime::String>(path_obj))
+      ovum::vm::runtime::String(temp_path.string());
   void* write_mode_obj = AllocateObjectByName(*this, "String");
-  new (ovum::vm::runtime::GetDataPointer<std::string>(write_mode_obj)) std::string(kModeWrite);
+  new (ovum::vm::runtime::GetDataPointer<ovum::vm::runtime::String>(write_mode_obj))
+      ovum::vm::runtime::String(kModeWrite);
   ASSERT_TRUE(ExecuteFunction(*this, "_File_Open_<M>_String_String", file_obj, path_obj, write_mode_obj).has_value());
 
   std::vector<uint8_t> bytes(std::begin(kContent), std::end(kContent) - 1);
@@ -477,7 +592,8 @@ TEST_F(BuiltinTestSuite, FileMethods) {
   EXPECT_TRUE(ExecuteFunction(*this, "_File_Close_<M>", file_obj).has_value());
 
   void* read_mode_obj = AllocateObjectByName(*this, "String");
-  new (ovum::vm::runtime::GetDataPointer<std::string>(read_mode_obj)) std::string(kModeRead);
+  new (ovum::vm::runtime::GetDataPointer<ovum::vm::runtime::String>(read_mode_obj))
+      ovum::vm::runtime::String(kModeRead);
   ASSERT_TRUE(ExecuteFunction(*this, "_File_Open_<M>_String_String", file_obj, path_obj, read_mode_obj).has_value());
 
   ASSERT_TRUE(ExecuteFunction(*this, "_File_Read_<M>_Int", file_obj, kReadSize).has_value());
@@ -490,9 +606,9 @@ TEST_F(BuiltinTestSuite, FileMethods) {
   ASSERT_TRUE(ExecuteFunction(*this, "_File_ReadLine_<M>", file_obj).has_value());
   auto read_line_obj = std::get<void*>(memory_.machine_stack.top());
   memory_.machine_stack.pop();
-  auto* read_line_str = ovum::vm::runtime::GetDataPointer<std::string>(read_line_obj);
-  EXPECT_FALSE(read_line_str->empty());
-  EXPECT_EQ(read_line_str->front(), '-');
+  auto* read_line_str = ovum::vm::runtime::GetDataPointer<ovum::vm::runtime::String>(read_line_obj);
+  EXPECT_FALSE(read_line_str->Empty());
+  EXPECT_EQ(read_line_str->View().front(), '-');
 
   ASSERT_TRUE(ExecuteFunction(*this, "_File_Eof_<C>", file_obj).has_value());
   ExpectStackTopEquals<bool>(*this, true);
@@ -644,11 +760,13 @@ TEST_F(BuiltinTestSuite, CopyAssignmentMethods) {
     void* string_obj2 = AllocateObjectByName(*this, "String");
     ASSERT_NE(string_obj1, nullptr);
     ASSERT_NE(string_obj2, nullptr);
-    new (ovum::vm::runtime::GetDataPointer<std::string>(string_obj1)) std::string(kInitialText);
-    new (ovum::vm::runtime::GetDataPointer<std::string>(string_obj2)) std::string(kAssignedText);
+    new (ovum::vm::runtime::GetDataPointer<ovum::vm::runtime::String>(string_obj1))
+        ovum::vm::runtime::String(kInitialText);
+    new (ovum::vm::runtime::GetDataPointer<ovum::vm::runtime::String>(string_obj2))
+        ovum::vm::runtime::String(kAssignedText);
 
     ASSERT_TRUE(ExecuteFunction(*this, "_String_copy_<M>_String", string_obj1, string_obj2).has_value());
-    EXPECT_EQ(*ovum::vm::runtime::GetDataPointer<std::string>(string_obj1), kAssignedText);
+    EXPECT_EQ(ovum::vm::runtime::GetDataPointer<ovum::vm::runtime::String>(string_obj1)->View(), kAssignedText);
   }
 
   // Test IntArray copy assignment
@@ -758,8 +876,8 @@ TEST_F(BuiltinTestSuite, CopyAssignmentMethods) {
     void* str2 = AllocateObjectByName(*this, "String");
     ASSERT_NE(str1, nullptr);
     ASSERT_NE(str2, nullptr);
-    new (ovum::vm::runtime::GetDataPointer<std::string>(str1)) std::string("first");
-    new (ovum::vm::runtime::GetDataPointer<std::string>(str2)) std::string("second");
+    new (ovum::vm::runtime::GetDataPointer<ovum::vm::runtime::String>(str1)) ovum::vm::runtime::String("first");
+    new (ovum::vm::runtime::GetDataPointer<ovum::vm::runtime::String>(str2)) ovum::vm::runtime::String("second");
 
     void* array1 = AllocateObjectByName(*this, "ObjectArray");
     void* array2 = AllocateObjectByName(*this, "ObjectArray");
@@ -783,8 +901,8 @@ TEST_F(BuiltinTestSuite, CopyAssignmentMethods) {
     void* str2 = AllocateObjectByName(*this, "String");
     ASSERT_NE(str1, nullptr);
     ASSERT_NE(str2, nullptr);
-    new (ovum::vm::runtime::GetDataPointer<std::string>(str1)) std::string("first");
-    new (ovum::vm::runtime::GetDataPointer<std::string>(str2)) std::string("second");
+    new (ovum::vm::runtime::GetDataPointer<ovum::vm::runtime::String>(str1)) ovum::vm::runtime::String("first");
+    new (ovum::vm::runtime::GetDataPointer<ovum::vm::runtime::String>(str2)) ovum::vm::runtime::String("second");
 
     void* array1 = AllocateObjectByName(*this, "StringArray");
     void* array2 = AllocateObjectByName(*this, "StringArray");
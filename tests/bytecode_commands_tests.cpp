@@ -8,16 +8,22 @@
 #include <string>
 #include <string_view>
 #include <thread>
+#include <vector>
 
 #include "lib/execution_tree/Command.hpp"
 #include "lib/execution_tree/ExecutionResult.hpp"
 #include "lib/execution_tree/Function.hpp"
+#include "lib/execution_tree/command_factory.hpp"
 #include "lib/executor/BuiltinFunctions.hpp"
+#include "lib/runtime/BoxCache.hpp"
+#include "lib/runtime/String.hpp"
+#include "lib/runtime/TypeIds.hpp"
 #include "lib/runtime/Variable.hpp"
 
 using ovum::vm::execution_tree::Command;
 using ovum::vm::execution_tree::ExecutionResult;
 using ovum::vm::runtime::GetDataPointer;
+using ovum::vm::runtime::String;
 using ovum::vm::runtime::Variable;
 
 namespace {
@@ -910,6 +916,333 @@ TEST_F(BuiltinTestSuite, CallVirtualConstructorAndFields) {
   PopObject();
 }
 
+TEST_F(BuiltinTestSuite, FieldsOfEveryTypeRoundTrip) {
+  constexpr size_t kDescriptorSize = sizeof(ovum::vm::runtime::ObjectDescriptor);
+  constexpr size_t kSlotSize = sizeof(int64_t);
+
+  ovum::vm::runtime::VirtualTable vt("AllFields", kDescriptorSize + 6 * kSlotSize);
+  const std::vector<std::string> types = {"int", "float", "bool", "char", "byte", "Object"};
+
+  for (size_t i = 0; i < types.size(); ++i) {
+    vt.AddField(types[i], static_cast<int64_t>(kDescriptorSize + i * kSlotSize));
+  }
+
+  vt.SetTriviallyDestructible(true);
+  auto vt_index = vtable_repo_.Add(std::move(vt));
+  ASSERT_TRUE(vt_index.has_value());
+  auto obj_res = memory_manager_.AllocateObject(
+      *vtable_repo_.GetByIndex(vt_index.value()).value(), static_cast<uint32_t>(vt_index.value()), data_);
+  ASSERT_TRUE(obj_res.has_value());
+  void* obj = obj_res.value();
+
+  const std::vector<ovum::vm::runtime::Variable> values = {int64_t{-7}, 2.5, true, 'q', uint8_t{200}, obj};
+
+  for (size_t i = 0; i < values.size(); ++i) {
+    memory_.machine_stack.emplace(values[i]);
+    PushObject(obj);
+    auto set_field = MakeIntCmd("SetField", static_cast<int64_t>(i));
+    ASSERT_TRUE(set_field);
+    ASSERT_TRUE(set_field->Execute(data_).has_value()) << types[i];
+  }
+
+  for (size_t i = 0; i < values.size(); ++i) {
+    PushObject(obj);
+    auto get_field = MakeIntCmd("GetField", static_cast<int64_t>(i));
+    ASSERT_TRUE(get_field);
+    ASSERT_TRUE(get_field->Execute(data_).has_value()) << types[i];
+    EXPECT_EQ(memory_.machine_stack.top(), values[i]) << types[i];
+    memory_.machine_stack.pop();
+  }
+
+  PushFloat(1.0);
+  PushObject(obj);
+  auto set_int_field = MakeIntCmd("SetField", 0);
+  ASSERT_TRUE(set_int_field);
+  EXPECT_FALSE(set_int_field->Execute(data_).has_value());
+
+  PushObject(obj);
+  auto get_missing_field = MakeIntCmd("GetField", static_cast<int64_t>(types.size()));
+  ASSERT_TRUE(get_missing_field);
+  EXPECT_FALSE(get_missing_field->Execute(data_).has_value());
+}
+
+TEST_F(BuiltinTestSuite, CallVirtualDispatchesThroughMethodSlots) {
+  constexpr std::string_view kMethodName = "_Describe_<C>";
+  const std::vector<std::pair<std::string, int64_t>> classes = {{"SlotFirst", 1}, {"SlotSecond", 2}};
+  std::vector<void*> objects;
+
+  auto call_virtual = MakeStringCmd("CallVirtual", std::string{kMethodName});
+  ASSERT_TRUE(call_virtual);
+
+  for (const auto& [class_name, result] : classes) {
+    ovum::vm::runtime::VirtualTable vt(class_name, sizeof(ovum::vm::runtime::ObjectDescriptor));
+    vt.AddFunction(std::string{kMethodName}, "_" + class_name + "_Describe_<C>");
+    vt.SetTriviallyDestructible(true);
+    auto vt_index = vtable_repo_.Add(std::move(vt));
+    ASSERT_TRUE(vt_index.has_value());
+
+    // Registered after the vtable, as the parser may do; the slot is bound on first dispatch
+    auto func = MakeStubFunction("_" + class_name + "_Describe_<C>", 1, [result](auto& data) {
+      data.memory.machine_stack.emplace(result);
+      return ExecutionResult::kNormal;
+    });
+    ASSERT_TRUE(function_repo_.Add(std::move(func)).has_value());
+
+    auto obj_res = memory_manager_.AllocateObject(
+        *vtable_repo_.GetByIndex(vt_index.value()).value(), static_cast<uint32_t>(vt_index.value()), data_);
+    ASSERT_TRUE(obj_res.has_value());
+    objects.push_back(obj_res.value());
+  }
+
+  for (int round = 0; round < 2; ++round) {
+    for (size_t i = 0; i < classes.size(); ++i) {
+      PushObject(objects[i]);
+      ASSERT_TRUE(call_virtual->Execute(data_).has_value());
+      EXPECT_EQ(PopInt(), classes[i].second);
+    }
+  }
+
+  auto call_missing = MakeStringCmd("CallVirtual", "_Missing_<C>");
+  ASSERT_TRUE(call_missing);
+  PushObject(objects[0]);
+  EXPECT_FALSE(call_missing->Execute(data_).has_value());
+}
+
+TEST_F(BuiltinTestSuite, IsTypeOperandResolvedBeforeClassIsRegistered) {
+  constexpr std::string_view kClassName = "LateRegistered";
+
+  auto is_late = MakeStringCmd("IsType", std::string{kClassName});
+  ASSERT_TRUE(is_late);
+  auto is_comparable = MakeStringCmd("IsType", "IComparable");
+  ASSERT_TRUE(is_comparable);
+
+  ovum::vm::runtime::VirtualTable vt(std::string{kClassName}, sizeof(ovum::vm::runtime::ObjectDescriptor));
+  vt.AddInterface("IComparable");
+  vt.SetTriviallyDestructible(true);
+  EXPECT_TRUE(vt.IsType(std::string{kClassName}));
+  EXPECT_TRUE(vt.IsType(ovum::vm::runtime::TypeIds::GetOrAssign("IComparable")));
+  EXPECT_FALSE(vt.IsType(ovum::vm::runtime::TypeIds::GetOrAssign("IHashable")));
+
+  auto vt_index = vtable_repo_.Add(std::move(vt));
+  ASSERT_TRUE(vt_index.has_value());
+  auto obj_res = memory_manager_.AllocateObject(
+      *vtable_repo_.GetByIndex(vt_index.value()).value(), static_cast<uint32_t>(vt_index.value()), data_);
+  ASSERT_TRUE(obj_res.has_value());
+
+  PushObject(obj_res.value());
+  ASSERT_TRUE(is_late->Execute(data_).has_value());
+  EXPECT_TRUE(PopBool());
+
+  // The instruction matches the exact class, interfaces are only checked for pure function arguments
+  PushObject(obj_res.value());
+  ASSERT_TRUE(is_comparable->Execute(data_).has_value());
+  EXPECT_FALSE(PopBool());
+}
+
+TEST_F(BuiltinTestSuite, StringLiteralsAreInterned) {
+  constexpr std::string_view kLiteral = "loop literal";
+  constexpr std::string_view kOtherLiteral = "other literal";
+  constexpr int kIterations = 100;
+
+  auto push_literal = MakeStringCmd("PushString", std::string{kLiteral});
+  ASSERT_TRUE(push_literal);
+  const size_t objects_before = memory_manager_.GetRepository().GetCount();
+  std::vector<void*> pushed;
+
+  for (int i = 0; i < kIterations; ++i) {
+    ASSERT_TRUE(push_literal->Execute(data_).has_value());
+    pushed.push_back(PopObject());
+  }
+
+  EXPECT_EQ(memory_manager_.GetRepository().GetCount(), objects_before);
+  EXPECT_EQ(memory_manager_.GetStringPool().GetCount(), 1u);
+  EXPECT_EQ(pushed.front(), pushed.back());
+  EXPECT_TRUE(ovum::vm::runtime::BoxCache::IsImmortal(pushed.front()));
+
+  auto push_other = MakeStringCmd("PushString", std::string{kOtherLiteral});
+  ASSERT_TRUE(push_other);
+  ASSERT_TRUE(push_other->Execute(data_).has_value());
+  void* other = PopObject();
+  EXPECT_NE(other, pushed.front());
+
+  ASSERT_TRUE(memory_manager_.CollectGarbage(data_).has_value());
+  EXPECT_EQ(GetDataPointer<String>(pushed.front())->View(), kLiteral);
+
+  auto copy_fn = function_repo_.GetByName("_String_copy_<M>_String");
+  ASSERT_TRUE(copy_fn.has_value());
+  memory_.machine_stack.emplace(other);
+  memory_.machine_stack.emplace(pushed.front());
+  EXPECT_FALSE(copy_fn.value()->Execute(data_).has_value());
+  EXPECT_EQ(GetDataPointer<String>(pushed.front())->View(), kLiteral);
+
+  // Results built from literals are ordinary collectable strings
+  PushObject(other);
+  PushObject(pushed.front());
+  auto concat = MakeSimple("StringConcat");
+  ASSERT_TRUE(concat);
+  ASSERT_TRUE(concat->Execute(data_).has_value());
+  EXPECT_FALSE(ovum::vm::runtime::BoxCache::IsImmortal(PopObject()));
+}
+
+TEST_F(BuiltinTestSuite, LiteralInitialisedStringCanBeAssigned) {
+  constexpr std::string_view kLiteral = "initial";
+  constexpr std::string_view kAssigned = "assigned";
+  constexpr int64_t kLocalIndex = 0;
+  constexpr int64_t kStaticIndex = 0;
+
+  auto push_literal = MakeStringCmd("PushString", std::string{kLiteral});
+  ASSERT_TRUE(push_literal);
+  auto copy_fn = function_repo_.GetByName("_String_copy_<M>_String");
+  ASSERT_TRUE(copy_fn.has_value());
+  void* source = MakeString(std::string{kAssigned});
+
+  ASSERT_TRUE(push_literal->Execute(data_).has_value());
+  void* literal = PopObject();
+  PushObject(literal);
+  auto set_local = MakeIntCmd("SetLocal", kLocalIndex);
+  ASSERT_TRUE(set_local);
+  ASSERT_TRUE(set_local->Execute(data_).has_value());
+  void* local = std::get<void*>(memory_.stack_frames.top().local_variables[kLocalIndex]);
+  EXPECT_NE(local, literal);
+  EXPECT_EQ(GetDataPointer<String>(local)->View(), kLiteral);
+
+  memory_.machine_stack.emplace(source);
+  memory_.machine_stack.emplace(local);
+  EXPECT_TRUE(copy_fn.value()->Execute(data_).has_value());
+  EXPECT_EQ(GetDataPointer<String>(local)->View(), kAssigned);
+
+  PushObject(literal);
+  auto set_static = MakeIntCmd("SetStatic", kStaticIndex);
+  ASSERT_TRUE(set_static);
+  ASSERT_TRUE(set_static->Execute(data_).has_value());
+  void* global = std::get<void*>(memory_.global_variables[kStaticIndex]);
+  memory_.machine_stack.emplace(source);
+  memory_.machine_stack.emplace(global);
+  EXPECT_TRUE(copy_fn.value()->Execute(data_).has_value());
+  EXPECT_EQ(GetDataPointer<String>(global)->View(), kAssigned);
+
+  ASSERT_TRUE(push_literal->Execute(data_).has_value());
+  EXPECT_EQ(PopObject(), literal);
+  EXPECT_EQ(GetDataPointer<String>(literal)->View(), kLiteral);
+}
+
+TEST_F(BuiltinTestSuite, SubstringsShareLargeParents) {
+  constexpr size_t kSourceLength = 1000;
+  constexpr int64_t kLargeSliceLength = 600;
+  constexpr int64_t kSmallSliceLength = 10;
+  constexpr int64_t kSliceStart = 100;
+
+  std::string text(kSourceLength, 'a');
+  text[kSliceStart] = 'b';
+  void* source = MakeString(text);
+  std::string_view source_view = GetDataPointer<String>(source)->View();
+  auto is_inside_source = [&](std::string_view view) {
+    return view.data() >= source_view.data() && view.data() < source_view.data() + source_view.size();
+  };
+
+  auto substr = MakeSimple("StringSubstring");
+  ASSERT_TRUE(substr);
+
+  PushInt(kLargeSliceLength);
+  PushInt(kSliceStart);
+  PushObject(source);
+  const size_t external_before = memory_manager_.GetExternalBytes();
+  ASSERT_TRUE(substr->Execute(data_).has_value());
+  std::string_view large_slice = GetDataPointer<String>(PopObject())->View();
+  EXPECT_EQ(large_slice, std::string_view(text).substr(kSliceStart, kLargeSliceLength));
+  EXPECT_TRUE(is_inside_source(large_slice));
+
+  // The shared buffer is already charged to the source; the slice adds only its own length
+  EXPECT_EQ(memory_manager_.GetExternalBytes() - external_before, static_cast<size_t>(kLargeSliceLength));
+
+  PushInt(kSmallSliceLength);
+  PushInt(kSliceStart);
+  PushObject(source);
+  ASSERT_TRUE(substr->Execute(data_).has_value());
+  std::string_view small_slice = GetDataPointer<String>(PopObject())->View();
+  EXPECT_EQ(small_slice, std::string_view(text).substr(kSliceStart, kSmallSliceLength));
+  EXPECT_FALSE(is_inside_source(small_slice));
+
+  PushInt(kSmallSliceLength);
+  PushInt(static_cast<int64_t>(kSourceLength) + 1);
+  PushObject(source);
+  EXPECT_FALSE(substr->Execute(data_).has_value());
+
+  PushInt(-1);
+  PushInt(kSliceStart);
+  PushObject(source);
+  ASSERT_TRUE(substr->Execute(data_).has_value());
+  EXPECT_EQ(GetDataPointer<String>(PopObject())->View(), std::string_view(text).substr(kSliceStart));
+
+  auto copy = MakeString("");
+  auto copy_fn = function_repo_.GetByName("_String_copy_<M>_String");
+  ASSERT_TRUE(copy_fn.has_value());
+  memory_.machine_stack.emplace(source);
+  memory_.machine_stack.emplace(copy);
+  ASSERT_TRUE(copy_fn.value()->Execute(data_).has_value());
+  EXPECT_EQ(GetDataPointer<String>(copy)->View().data(), source_view.data());
+
+  auto hash_fn = function_repo_.GetByName("_String_GetHash_<C>");
+  ASSERT_TRUE(hash_fn.has_value());
+  memory_.machine_stack.emplace(copy);
+  ASSERT_TRUE(hash_fn.value()->Execute(data_).has_value());
+  EXPECT_EQ(PopInt(), static_cast<int64_t>(std::hash<std::string>{}(text)));
+}
+
+TEST_F(BuiltinTestSuite, FusedAllocationsDoNotAllocate) {
+  constexpr int64_t kValue = 17;
+  constexpr int64_t kDefault = 3;
+
+  using ovum::vm::execution_tree::CreateFusedAllocationCommand;
+  EXPECT_FALSE(CreateFusedAllocationCommand("_Int_int", "IsNull").has_value());
+  EXPECT_FALSE(CreateFusedAllocationCommand("PushNull", "Unwrap").has_value());
+
+  auto unwrap_int = CreateFusedAllocationCommand("_Int_int", "Unwrap");
+  auto unwrap_nullable = CreateFusedAllocationCommand("_Nullable_Object", "Unwrap");
+  auto is_null = CreateFusedAllocationCommand("_Nullable_Object", "IsNull");
+  auto coalesce = CreateFusedAllocationCommand("_Nullable_Object", "NullCoalesce");
+  auto null_is_null = CreateFusedAllocationCommand("PushNull", "IsNull");
+  ASSERT_TRUE(unwrap_int && unwrap_nullable && is_null && coalesce && null_is_null);
+
+  void* str = MakeString("value");
+  const size_t objects_before = memory_manager_.GetRepository().GetCount();
+
+  PushInt(kValue);
+  ASSERT_TRUE(unwrap_int.value()->Execute(data_).has_value());
+  EXPECT_EQ(PopInt(), kValue);
+
+  PushBool(true);
+  EXPECT_FALSE(unwrap_int.value()->Execute(data_).has_value());
+  EXPECT_TRUE(PopBool());
+
+  PushObject(str);
+  ASSERT_TRUE(unwrap_nullable.value()->Execute(data_).has_value());
+  EXPECT_EQ(PopObject(), str);
+
+  PushObject(nullptr);
+  EXPECT_FALSE(unwrap_nullable.value()->Execute(data_).has_value());
+
+  PushObject(nullptr);
+  ASSERT_TRUE(is_null.value()->Execute(data_).has_value());
+  EXPECT_TRUE(PopBool());
+
+  PushInt(kDefault);
+  PushObject(str);
+  ASSERT_TRUE(coalesce.value()->Execute(data_).has_value());
+  EXPECT_EQ(PopObject(), str);
+
+  PushInt(kDefault);
+  PushObject(nullptr);
+  ASSERT_TRUE(coalesce.value()->Execute(data_).has_value());
+  EXPECT_EQ(PopInt(), kDefault);
+
+  ASSERT_TRUE(null_is_null.value()->Execute(data_).has_value());
+  EXPECT_TRUE(PopBool());
+
+  EXPECT_TRUE(memory_.machine_stack.empty());
+  EXPECT_EQ(memory_manager_.GetRepository().GetCount(), objects_before);
+}
+
 TEST_F(BuiltinTestSuite, NullableAndSafeCallCommands) {
   constexpr std::string_view kInnerValue = "hi";
   constexpr int64_t kCoalesceInt = 0;
@@ -974,8 +1307,145 @@ TEST_F(BuiltinTestSuite, NullableAndSafeCallCommands) {
   EXPECT_TRUE(unwrap->Execute(data_).has_value());
   ASSERT_TRUE(std::holds_alternative<void*>(memory_.machine_stack.top()));
   auto unwrapped = PopObject();
-  auto* unwrapped_str = ovum::vm::runtime::GetDataPointer<std::string>(unwrapped);
-  EXPECT_EQ(*unwrapped_str, kInnerValue);
+  auto* unwrapped_str = GetDataPointer<String>(unwrapped);
+  EXPECT_EQ(unwrapped_str->View(), kInnerValue);
+}
+
+TEST_F(BuiltinTestSuite, SafeCallBoxesSmallValuesFromCache) {
+  constexpr int64_t kSafeReturnValue = 7;
+  constexpr int64_t kAssignedValue = 8;
+  constexpr std::string_view kSafeMethodName = "SmallIntMethod";
+
+  auto safe_func = MakeStubFunction(std::string{kSafeMethodName}, 1, [kSafeReturnValue](auto& data) {
+    data.memory.machine_stack.emplace(static_cast<int64_t>(kSafeReturnValue));
+    return ExecutionResult::kNormal;
+  });
+  ASSERT_TRUE(function_repo_.Add(std::move(safe_func)).has_value());
+
+  auto inner = MakeString("receiver");
+  std::vector<void*> boxes;
+
+  for (int i = 0; i < 2; ++i) {
+    PushObject(MakeNullable(inner));
+    const size_t objects_before = memory_manager_.GetRepository().GetCount();
+    auto safe_call = MakeStringCmd("SafeCall", std::string{kSafeMethodName});
+    ASSERT_TRUE(safe_call);
+    ASSERT_TRUE(safe_call->Execute(data_).has_value());
+
+    // Only the Nullable result is allocated
+    EXPECT_EQ(memory_manager_.GetRepository().GetCount(), objects_before + 1);
+    boxes.push_back(*GetDataPointer<void*>(PopObject()));
+  }
+
+  EXPECT_EQ(boxes[0], boxes[1]);
+  EXPECT_TRUE(ovum::vm::runtime::BoxCache::IsImmortal(boxes[0]));
+  EXPECT_EQ(*GetDataPointer<int64_t>(boxes[0]), kSafeReturnValue);
+
+  ASSERT_TRUE(memory_manager_.CollectGarbage(data_).has_value());
+  EXPECT_EQ(*GetDataPointer<int64_t>(boxes[0]), kSafeReturnValue);
+
+  auto copy_fn = function_repo_.GetByName("_Int_copy_<M>_int");
+  ASSERT_TRUE(copy_fn.has_value());
+  memory_.machine_stack.emplace(kAssignedValue);
+  memory_.machine_stack.emplace(boxes[0]);
+  EXPECT_FALSE(copy_fn.value()->Execute(data_).has_value());
+  EXPECT_EQ(*GetDataPointer<int64_t>(boxes[0]), kSafeReturnValue);
+}
+
+TEST_F(BuiltinTestSuite, UnwrappedCachedBoxCanBeAssigned) {
+  constexpr int64_t kSafeReturnValue = 5;
+  constexpr int64_t kAssignedValue = 6;
+  constexpr std::string_view kSafeMethodName = "CachedIntMethod";
+
+  auto safe_func = MakeStubFunction(std::string{kSafeMethodName}, 1, [kSafeReturnValue](auto& data) {
+    data.memory.machine_stack.emplace(static_cast<int64_t>(kSafeReturnValue));
+    return ExecutionResult::kNormal;
+  });
+  ASSERT_TRUE(function_repo_.Add(std::move(safe_func)).has_value());
+
+  auto safe_call = MakeStringCmd("SafeCall", std::string{kSafeMethodName});
+  ASSERT_TRUE(safe_call);
+  auto unwrap = MakeSimple("Unwrap");
+  ASSERT_TRUE(unwrap);
+  auto copy_fn = function_repo_.GetByName("_Int_copy_<M>_int");
+  ASSERT_TRUE(copy_fn.has_value());
+
+  PushObject(MakeNullable(MakeString("receiver")));
+  ASSERT_TRUE(safe_call->Execute(data_).has_value());
+  void* cached_box = *GetDataPointer<void*>(std::get<void*>(memory_.machine_stack.top()));
+  ASSERT_TRUE(ovum::vm::runtime::BoxCache::IsImmortal(cached_box));
+  ASSERT_TRUE(unwrap->Execute(data_).has_value());
+  void* unwrapped = PopObject();
+  EXPECT_NE(unwrapped, cached_box);
+  EXPECT_FALSE(ovum::vm::runtime::BoxCache::IsImmortal(unwrapped));
+
+  memory_.machine_stack.emplace(kAssignedValue);
+  memory_.machine_stack.emplace(unwrapped);
+  EXPECT_TRUE(copy_fn.value()->Execute(data_).has_value());
+  EXPECT_EQ(*GetDataPointer<int64_t>(unwrapped), kAssignedValue);
+  EXPECT_EQ(*GetDataPointer<int64_t>(cached_box), kSafeReturnValue);
+
+  auto coalesce = MakeSimple("NullCoalesce");
+  ASSERT_TRUE(coalesce);
+  PushObject(MakeString("default"));
+  PushObject(MakeNullable(MakeString("receiver")));
+  ASSERT_TRUE(safe_call->Execute(data_).has_value());
+  ASSERT_TRUE(coalesce->Execute(data_).has_value());
+  void* coalesced = PopObject();
+  EXPECT_NE(coalesced, cached_box);
+  EXPECT_EQ(*GetDataPointer<int64_t>(coalesced), kSafeReturnValue);
+}
+
+TEST_F(BuiltinTestSuite, SharedNullCannotBeMutated) {
+  auto null_res = memory_manager_.GetBoxCache().GetNullBox(vtable_repo_);
+  ASSERT_TRUE(null_res.has_value());
+  void* null_box = null_res.value();
+  void* referent = MakeString("referent");
+
+  auto ctor_fn = function_repo_.GetByName("_Nullable_Object");
+  ASSERT_TRUE(ctor_fn.has_value());
+  memory_.machine_stack.emplace(referent);
+  memory_.machine_stack.emplace(null_box);
+  EXPECT_FALSE(ctor_fn.value()->Execute(data_).has_value());
+  EXPECT_EQ(*GetDataPointer<void*>(null_box), nullptr);
+
+  auto push_null = MakeSimple("PushNull");
+  ASSERT_TRUE(push_null);
+  ASSERT_TRUE(push_null->Execute(data_).has_value());
+  ExpectTopNullableHasValue(false);
+}
+
+TEST_F(BuiltinTestSuite, NullIsSharedAndNotAllocated) {
+  constexpr std::string_view kNullMethodName = "NullReturningMethod";
+
+  auto push_null = MakeSimple("PushNull");
+  ASSERT_TRUE(push_null);
+  const size_t objects_before = memory_manager_.GetRepository().GetCount();
+  ASSERT_TRUE(push_null->Execute(data_).has_value());
+  ASSERT_TRUE(push_null->Execute(data_).has_value());
+  EXPECT_EQ(memory_manager_.GetRepository().GetCount(), objects_before);
+
+  void* first_null = PopObject();
+  void* second_null = PopObject();
+  EXPECT_EQ(first_null, second_null);
+  EXPECT_TRUE(ovum::vm::runtime::BoxCache::IsImmortal(first_null));
+  EXPECT_EQ(*GetDataPointer<void*>(first_null), nullptr);
+
+  auto null_func = MakeStubFunction(std::string{kNullMethodName}, 1, [](auto& data) {
+    data.memory.machine_stack.emplace(static_cast<void*>(nullptr));
+    return ExecutionResult::kNormal;
+  });
+  ASSERT_TRUE(function_repo_.Add(std::move(null_func)).has_value());
+
+  PushObject(MakeNullable(MakeString("receiver")));
+  auto safe_call = MakeStringCmd("SafeCall", std::string{kNullMethodName});
+  ASSERT_TRUE(safe_call);
+  ASSERT_TRUE(safe_call->Execute(data_).has_value());
+  ExpectTopNullableHasValue(false);
+  EXPECT_EQ(PopObject(), first_null);
+
+  ASSERT_TRUE(memory_manager_.CollectGarbage(data_).has_value());
+  EXPECT_EQ(*GetDataPointer<void*>(first_null), nullptr);
 }
 
 TEST_F(BuiltinTestSuite, TypeOperations) {
@@ -1093,8 +1563,8 @@ TEST_F(BuiltinTestSuite, TimeCommands) {
   ASSERT_TRUE(format_cmd);
   EXPECT_TRUE(format_cmd->Execute(data_).has_value());
   {
-    auto* str = ovum::vm::runtime::GetDataPointer<std::string>(std::get<void*>(memory_.machine_stack.top()));
-    EXPECT_FALSE(str->empty());
+    auto* str = GetDataPointer<String>(std::get<void*>(memory_.machine_stack.top()));
+    EXPECT_FALSE(str->Empty());
     PopObject();
   }
 
@@ -1230,8 +1700,8 @@ TEST_F(BuiltinTestSuite, SystemCommands) {
     ASSERT_TRUE(std::holds_alternative<void*>(memory_.machine_stack.top()));
     auto* nullable_ptr = GetDataPointer<void*>(std::get<void*>(memory_.machine_stack.top()));
     if (*nullable_ptr != nullptr) {
-      auto* str_ptr = GetDataPointer<std::string>(*nullable_ptr);
-      EXPECT_EQ(*str_ptr, kEnvValue);
+      auto* str_ptr = GetDataPointer<String>(*nullable_ptr);
+      EXPECT_EQ(str_ptr->View(), kEnvValue);
     }
     PopObject();
   }
@@ -1328,8 +1798,8 @@ TEST_F(BuiltinTestSuite, MemoryAndOsInfoCommands) {
   EXPECT_TRUE(os_name->Execute(data_).has_value());
   {
     ASSERT_TRUE(std::holds_alternative<void*>(memory_.machine_stack.top()));
-    auto* str = GetDataPointer<std::string>(std::get<void*>(memory_.machine_stack.top()));
-    EXPECT_FALSE(str->empty());
+    auto* str = GetDataPointer<String>(std::get<void*>(memory_.machine_stack.top()));
+    EXPECT_FALSE(str->Empty());
     PopObject();
   }
 
@@ -1359,7 +1829,7 @@ TEST_F(BuiltinTestSuite, TypeIntrospectionAndSizeOf) {
   constexpr std::string_view kByteType = "byte";
   constexpr std::string_view kStringValue = "text";
   constexpr std::string_view kStringType = "String";
-  constexpr auto kStringSize = static_cast<int64_t>(sizeof(ovum::vm::runtime::ObjectDescriptor) + sizeof(std::string));
+  constexpr auto kStringSize = static_cast<int64_t>(sizeof(ovum::vm::runtime::ObjectDescriptor) + sizeof(String));
 
   PushByte(kByteValue);
   auto type_of = MakeSimple("TypeOf");
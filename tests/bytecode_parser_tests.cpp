@@ -398,6 +398,37 @@ TEST_F(BytecodeParserTestSuite, Vtable_Minimal_AutoDestructor) {
   AssertFunctionCount(func_repo, 1);
 }
 
+TEST_F(BytecodeParserTestSuite, Vtable_AutoDestructor_IsTriviallyDestructible) {
+  auto parser = CreateParserWithJit();
+  auto tokens = TokenizeString("vtable ClassName { }");
+  ovum::vm::execution_tree::FunctionRepository func_repo;
+  ovum::vm::runtime::VirtualTableRepository vtable_repo;
+
+  auto parsing_result = ParseSuccessfully(parser, tokens, func_repo, vtable_repo);
+  auto vtable_result = vtable_repo.GetByName("ClassName");
+  ASSERT_TRUE(vtable_result.has_value());
+  EXPECT_TRUE(vtable_result.value()->IsTriviallyDestructible());
+}
+
+TEST_F(BytecodeParserTestSuite, Vtable_EmptyDeclaredDestructor_IsTriviallyDestructible) {
+  auto parser = CreateParserWithJit();
+  auto tokens = TokenizeString(
+      "vtable Empty { methods { _destructor_<M>:Empty_destructor_<M> } } "
+      "vtable Busy { methods { _destructor_<M>:Busy_destructor_<M> } } "
+      "function:1 Empty_destructor_<M> { } "
+      "function:1 Busy_destructor_<M> { PushInt 42 Return }");
+  ovum::vm::execution_tree::FunctionRepository func_repo;
+  ovum::vm::runtime::VirtualTableRepository vtable_repo;
+
+  auto parsing_result = ParseSuccessfully(parser, tokens, func_repo, vtable_repo);
+  auto empty_vtable = vtable_repo.GetByName("Empty");
+  auto busy_vtable = vtable_repo.GetByName("Busy");
+  ASSERT_TRUE(empty_vtable.has_value());
+  ASSERT_TRUE(busy_vtable.has_value());
+  EXPECT_TRUE(empty_vtable.value()->IsTriviallyDestructible());
+  EXPECT_FALSE(busy_vtable.value()->IsTriviallyDestructible());
+}
+
 TEST_F(BytecodeParserTestSuite, Vtable_WithSize) {
   auto parser = CreateParserWithJit();
   auto tokens = TokenizeString("vtable ClassName { size: 100 }");
@@ -452,6 +483,52 @@ TEST_F(BytecodeParserTestSuite, Vtable_WithAllSections) {
   AssertVtableExists(vtable_repo, "ClassName");
 }
 
+TEST_F(BytecodeParserTestSuite, Vtable_FieldPackingKeepsIndicesAndShrinksObject) {
+  auto parser = CreateParserWithFieldPacking();
+  auto tokens = TokenizeString(
+      "vtable Mixed { size: 48 vartable { a:bool@8, b:int@16, c:char@24, d:Object@32, e:byte@40 } }");
+  ovum::vm::execution_tree::FunctionRepository func_repo;
+  ovum::vm::runtime::VirtualTableRepository vtable_repo;
+
+  auto parsing_result = ParseSuccessfully(parser, tokens, func_repo, vtable_repo);
+  auto vtable = vtable_repo.GetByName("Mixed");
+  ASSERT_TRUE(vtable.has_value());
+  EXPECT_EQ(vtable.value()->GetSize(), 32U);
+
+  ASSERT_EQ(parser.GetPackedLayouts().size(), 1U);
+  EXPECT_EQ(parser.GetPackedLayouts()[0].class_name, "Mixed");
+  EXPECT_EQ(parser.GetPackedLayouts()[0].declared_size, 48U);
+  EXPECT_EQ(parser.GetPackedLayouts()[0].packed_size, 32U);
+
+  // Writing every field through its original index must not clobber any other field
+  std::vector<char> object(vtable.value()->GetSize(), 0);
+  int marker = 0;
+  ASSERT_TRUE(vtable.value()->SetVariableByIndex(object.data(), 0, true).has_value());
+  ASSERT_TRUE(vtable.value()->SetVariableByIndex(object.data(), 1, int64_t{-7}).has_value());
+  ASSERT_TRUE(vtable.value()->SetVariableByIndex(object.data(), 2, 'x').has_value());
+  ASSERT_TRUE(vtable.value()->SetVariableByIndex(object.data(), 3, static_cast<void*>(&marker)).has_value());
+  ASSERT_TRUE(vtable.value()->SetVariableByIndex(object.data(), 4, uint8_t{200}).has_value());
+
+  EXPECT_EQ(std::get<bool>(vtable.value()->GetVariableByIndex(object.data(), 0).value()), true);
+  EXPECT_EQ(std::get<int64_t>(vtable.value()->GetVariableByIndex(object.data(), 1).value()), -7);
+  EXPECT_EQ(std::get<char>(vtable.value()->GetVariableByIndex(object.data(), 2).value()), 'x');
+  EXPECT_EQ(std::get<void*>(vtable.value()->GetVariableByIndex(object.data(), 3).value()), &marker);
+  EXPECT_EQ(std::get<uint8_t>(vtable.value()->GetVariableByIndex(object.data(), 4).value()), 200);
+}
+
+TEST_F(BytecodeParserTestSuite, Vtable_FieldPackingDisabledKeepsDeclaredLayout) {
+  auto parser = CreateParserWithJit();
+  auto tokens = TokenizeString("vtable Mixed { size: 48 vartable { a:bool@8, b:int@16, c:char@24 } }");
+  ovum::vm::execution_tree::FunctionRepository func_repo;
+  ovum::vm::runtime::VirtualTableRepository vtable_repo;
+
+  auto parsing_result = ParseSuccessfully(parser, tokens, func_repo, vtable_repo);
+  auto vtable = vtable_repo.GetByName("Mixed");
+  ASSERT_TRUE(vtable.has_value());
+  EXPECT_EQ(vtable.value()->GetSize(), 48U);
+  EXPECT_TRUE(parser.GetPackedLayouts().empty());
+}
+
 TEST_F(BytecodeParserTestSuite, Vtable_WithManualDestructor) {
   auto parser = CreateParserWithJit();
   auto tokens = TokenizeString(R"(vtable ClassName { methods { ClassName_destructor_<M>:ClassName_destructor_<M> } })");
@@ -977,3 +1054,33 @@ TEST_F(BytecodeParserTestSuite, Integration_ComplexNestedStructures) {
 
   auto parsing_result = ParseSuccessfully(parser, tokens, func_repo, vtable_repo);
 }
+
+TEST_F(BytecodeParserTestSuite, Integration_FusedAllocationsAreRecorded) {
+  auto parser = CreateParserWithJit();
+  auto tokens = TokenizeString("function:0 wrap { PushInt 1 CallConstructor _Int_int Unwrap PushNull IsNull Return }");
+  ovum::vm::execution_tree::FunctionRepository func_repo;
+  ovum::vm::runtime::VirtualTableRepository vtable_repo;
+
+  auto result = ParseSuccessfully(parser, tokens, func_repo, vtable_repo);
+  const auto& sites = parser.GetFusedAllocations();
+  ASSERT_EQ(sites.size(), 2U);
+  ASSERT_EQ(sites[0].function_name, "wrap");
+  ASSERT_EQ(sites[0].allocation, "_Int_int");
+  ASSERT_EQ(sites[0].consumer, "Unwrap");
+  ASSERT_EQ(sites[1].allocation, "PushNull");
+  ASSERT_EQ(sites[1].consumer, "IsNull");
+}
+
+TEST_F(BytecodeParserTestSuite, Integration_StringLiteralsInternedAtParseTime) {
+  auto parser = CreateParserWithoutJit();
+  auto tokens = TokenizeString(R"(function:0 greet { PushString "hi" PushString "hi" PushString "bye" Return })");
+  ovum::vm::execution_tree::FunctionRepository func_repo;
+  ovum::vm::runtime::VirtualTableRepository vtable_repo;
+  ASSERT_TRUE(ovum::vm::runtime::RegisterBuiltinVirtualTables(vtable_repo).has_value());
+  ovum::vm::runtime::RuntimeMemory memory;
+  ovum::vm::runtime::StringPool string_pool;
+
+  auto result = parser.Parse(tokens, func_repo, vtable_repo, memory, string_pool);
+  ASSERT_TRUE(result.has_value()) << result.error().what();
+  ASSERT_EQ(string_pool.GetCount(), 2U);
+}
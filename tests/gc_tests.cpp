@@ -2,10 +2,16 @@
 
 #include "tests/test_suites/GcTestSuite.hpp"
 
+#include <chrono>
 #include <memory>
+#include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "lib/execution_tree/PassedExecutionData.hpp"
+#include "lib/runtime/gc/MarkCompactGC.hpp"
+#include "lib/runtime/gc/ReservedRegion.hpp"
+#include "lib/runtime/gc/reference_scanners/WeakReferenceScanner.hpp"
 
 TEST_F(GcTestSuite, UnreachableObjectCollected) {
   auto data = MakeFreshData();
@@ -172,6 +178,40 @@ TEST_F(GcTestSuite, SmallThresholdFrequentAllocations) {
   }
 }
 
+TEST_F(GcTestSuite, ScanningReadsOnlyReferenceFieldOffsets) {
+  ovum::vm::runtime::VirtualTable plain("Plain", sizeof(ovum::vm::runtime::ObjectDescriptor) + 2 * sizeof(int64_t));
+  plain.AddField("int", sizeof(ovum::vm::runtime::ObjectDescriptor));
+  plain.AddField("float", sizeof(ovum::vm::runtime::ObjectDescriptor) + sizeof(int64_t));
+  EXPECT_FALSE(plain.HasReferences());
+
+  ovum::vm::runtime::VirtualTable mixed("Mixed", sizeof(ovum::vm::runtime::ObjectDescriptor) + 3 * sizeof(void*));
+  mixed.AddField("int", sizeof(ovum::vm::runtime::ObjectDescriptor));
+  mixed.AddField("Object", sizeof(ovum::vm::runtime::ObjectDescriptor) + sizeof(void*));
+  mixed.AddField("bool", sizeof(ovum::vm::runtime::ObjectDescriptor) + 2 * sizeof(void*));
+  EXPECT_TRUE(mixed.HasReferences());
+
+  struct MixedLayout {
+    ovum::vm::runtime::ObjectDescriptor desc;
+    int64_t number;
+    void* ref;
+    bool flag;
+  };
+
+  int referent = 0;
+  MixedLayout obj{.desc = {}, .number = 42, .ref = &referent, .flag = true};
+  std::vector<void*> visited;
+
+  mixed.ScanReferences(&obj, [&visited](void* ref) { visited.push_back(ref); });
+  plain.ScanReferences(&obj, [&visited](void* ref) { visited.push_back(ref); });
+
+  ASSERT_EQ(visited.size(), 1u);
+  EXPECT_EQ(visited[0], &referent);
+
+  mixed.UpdateReferences(&obj, [](void*) -> void* { return nullptr; });
+  EXPECT_EQ(obj.ref, nullptr);
+  EXPECT_EQ(obj.number, 42);
+}
+
 TEST_F(GcTestSuite, NullReferencesNotCrashing) {
   auto data = MakeFreshData();
 
@@ -184,3 +224,706 @@ TEST_F(GcTestSuite, NullReferencesNotCrashing) {
 
   EXPECT_TRUE(RepoContains(mm_.GetRepository(), root));
 }
+
+TEST_F(GcTestSuite, LazySweepReclaimsInBoundedSteps) {
+  auto data = MakeFreshData(kDefaultHeapTargetBytes, std::make_unique<ovum::vm::runtime::MarkAndSweepGC>(2));
+
+  void* root = AllocateTestObject("Simple", data);
+  data.memory.global_variables.emplace_back(root);
+
+  for (int i = 0; i < 5; ++i) {
+    AllocateTestObject("Simple", data);
+  }
+
+  CollectGarbage(data);
+
+  EXPECT_EQ(SnapshotRepo(mm_.GetRepository()).size(), 6u);
+
+  auto step_res = data.memory_manager.CollectGarbageIfRequired(data);
+  ASSERT_TRUE(step_res.has_value());
+  EXPECT_EQ(SnapshotRepo(mm_.GetRepository()).size(), 4u);
+
+  for (int i = 0; i < 2; ++i) {
+    step_res = data.memory_manager.CollectGarbageIfRequired(data);
+    ASSERT_TRUE(step_res.has_value());
+  }
+
+  EXPECT_EQ(SnapshotRepo(mm_.GetRepository()).size(), 1u);
+  EXPECT_TRUE(RepoContains(mm_.GetRepository(), root));
+}
+
+TEST_F(GcTestSuite, LazySweepDrivenByAllocation) {
+  auto data = MakeFreshData(kDefaultHeapTargetBytes, std::make_unique<ovum::vm::runtime::MarkAndSweepGC>(2));
+
+  for (int i = 0; i < 4; ++i) {
+    AllocateTestObject("Simple", data);
+  }
+
+  CollectGarbage(data);
+
+  void* fresh = AllocateTestObject("Simple", data);
+
+  EXPECT_EQ(SnapshotRepo(mm_.GetRepository()).size(), 3u);
+  EXPECT_TRUE(RepoContains(mm_.GetRepository(), fresh));
+}
+
+TEST_F(GcTestSuite, LazySweepFinishedBeforeNextCollection) {
+  auto data = MakeFreshData(kDefaultHeapTargetBytes, std::make_unique<ovum::vm::runtime::MarkAndSweepGC>(1));
+
+  void* root = AllocateTestObject("WithRef", data);
+  void* child = AllocateTestObject("Simple", data);
+  SetRef(root, child);
+  data.memory.global_variables.emplace_back(root);
+
+  for (int i = 0; i < 3; ++i) {
+    AllocateTestObject("WithRef", data);
+  }
+
+  CollectGarbage(data);
+  CollectGarbage(data);
+
+  auto snapshot = SnapshotRepo(mm_.GetRepository());
+  EXPECT_EQ(snapshot.size(), 2u);
+  EXPECT_TRUE(snapshot.contains(root));
+  EXPECT_TRUE(snapshot.contains(child));
+}
+
+TEST_F(GcTestSuite, IncrementalMarkingKeepsObjectsStoredDuringCycle) {
+  auto gc = std::make_unique<ovum::vm::runtime::MarkAndSweepGC>(0, std::chrono::microseconds(1));
+  ovum::vm::runtime::MarkAndSweepGC* collector = gc.get();
+  auto data = MakeFreshData(10, std::move(gc));
+
+  void* arr = AllocateTestObject("Array", data);
+  InitArray(arr);
+  data.memory.global_variables.emplace_back(arr);
+
+  for (int i = 0; i < 20000; ++i) {
+    AddToArray(arr, AllocateTestObject("Simple", data));
+  }
+
+  void* holder = AllocateTestObject("WithRef", data);
+  AddToArray(arr, holder);
+
+  void* garbage = AllocateTestObject("Simple", data);
+
+  auto gc_res = data.memory_manager.CollectGarbageIfRequired(data);
+  ASSERT_TRUE(gc_res.has_value());
+  ASSERT_TRUE(collector->IsMarking());
+
+  void* fresh = AllocateTestObject("Simple", data);
+  data.memory_manager.WriteBarrier(fresh);
+  SetRef(holder, fresh);
+
+  size_t steps = 1;
+
+  while (collector->IsMarking()) {
+    gc_res = data.memory_manager.CollectGarbageIfRequired(data);
+    ASSERT_TRUE(gc_res.has_value());
+    ++steps;
+  }
+
+  EXPECT_GT(steps, 1u);
+  EXPECT_TRUE(RepoContains(mm_.GetRepository(), holder));
+  EXPECT_TRUE(RepoContains(mm_.GetRepository(), fresh));
+  EXPECT_FALSE(RepoContains(mm_.GetRepository(), garbage));
+  EXPECT_EQ(SnapshotRepo(mm_.GetRepository()).size(), 20003u);
+}
+
+TEST_F(GcTestSuite, FullCollectionFinishesIncrementalCycle) {
+  auto gc = std::make_unique<ovum::vm::runtime::MarkAndSweepGC>(0, std::chrono::microseconds(1));
+  ovum::vm::runtime::MarkAndSweepGC* collector = gc.get();
+  auto data = MakeFreshData(10, std::move(gc));
+
+  void* arr = AllocateTestObject("Array", data);
+  InitArray(arr);
+  data.memory.global_variables.emplace_back(arr);
+
+  for (int i = 0; i < 20000; ++i) {
+    AddToArray(arr, AllocateTestObject("Simple", data));
+  }
+
+  void* garbage = AllocateTestObject("Simple", data);
+
+  auto gc_res = data.memory_manager.CollectGarbageIfRequired(data);
+  ASSERT_TRUE(gc_res.has_value());
+
+  void* local = AllocateTestObject("Simple", data);
+  data.memory.machine_stack.emplace(local);
+
+  CollectGarbage(data);
+
+  EXPECT_FALSE(collector->IsMarking());
+  EXPECT_TRUE(RepoContains(mm_.GetRepository(), local));
+  EXPECT_FALSE(RepoContains(mm_.GetRepository(), garbage));
+  EXPECT_EQ(SnapshotRepo(mm_.GetRepository()).size(), 20002u);
+}
+
+TEST_F(GcTestSuite, CompactionSlidesLiveObjectsAndUpdatesReferences) {
+  auto data = MakeFreshData(kDefaultHeapTargetBytes, std::make_unique<ovum::vm::runtime::MarkCompactGC>(4096, 0.1));
+
+  for (int i = 0; i < 8; ++i) {
+    AllocateTestObject("Simple", data);
+  }
+
+  void* head = AllocateTestObject("WithRef", data);
+  void* tail = AllocateTestObject("WithRef", data);
+  SetRef(head, tail);
+  SetRef(tail, nullptr);
+  data.memory.global_variables.emplace_back(head);
+
+  CollectGarbage(data);
+
+  void* moved_head = std::get<void*>(data.memory.global_variables.back());
+  ASSERT_LT(moved_head, head);
+  ASSERT_TRUE(RepoContains(mm_.GetRepository(), moved_head));
+
+  void* moved_tail = GetRef(moved_head);
+  EXPECT_LT(moved_tail, tail);
+  EXPECT_TRUE(RepoContains(mm_.GetRepository(), moved_tail));
+  EXPECT_EQ(GetRef(moved_tail), nullptr);
+  EXPECT_EQ(TypeOf(moved_tail, data), "WithRef");
+  EXPECT_EQ(SnapshotRepo(mm_.GetRepository()).size(), 2u);
+}
+
+TEST_F(GcTestSuite, PinnedObjectIsNotMovedByCompaction) {
+  auto data = MakeFreshData(kDefaultHeapTargetBytes, std::make_unique<ovum::vm::runtime::MarkCompactGC>(4096, 0.1));
+
+  for (int i = 0; i < 8; ++i) {
+    AllocateTestObject("Simple", data);
+  }
+
+  void* pinned = AllocateTestObject("WithRef", data);
+  SetRef(pinned, nullptr);
+  data.memory.global_variables.emplace_back(pinned);
+  data.memory_manager.Pin(pinned);
+
+  void* movable = AllocateTestObject("Simple", data);
+  data.memory.global_variables.emplace_back(movable);
+
+  CollectGarbage(data);
+
+  EXPECT_EQ(std::get<void*>(data.memory.global_variables[0]), pinned);
+  EXPECT_TRUE(RepoContains(mm_.GetRepository(), pinned));
+  EXPECT_GT(std::get<void*>(data.memory.global_variables[1]), pinned);
+  EXPECT_EQ(SnapshotRepo(mm_.GetRepository()).size(), 2u);
+
+  data.memory_manager.Unpin(pinned);
+}
+
+TEST_F(GcTestSuite, CompactionReturnsFreedPagesToTheOs) {
+  auto gc = std::make_unique<ovum::vm::runtime::MarkCompactGC>(1024 * 1024, 0.1);
+  ovum::vm::runtime::MarkCompactGC* compact_gc = gc.get();
+  auto data = MakeFreshData(kDefaultHeapTargetBytes, std::move(gc));
+
+  data.memory.global_variables.emplace_back(AllocateTestObject("Simple", data));
+
+  for (int i = 0; i < 8192; ++i) {
+    AllocateTestObject("Simple", data);
+  }
+
+  const size_t committed_before = compact_gc->GetCommittedBytes();
+  ASSERT_GT(committed_before, 4 * ovum::vm::runtime::ReservedRegion::GetPageSize());
+
+  CollectGarbage(data);
+
+  EXPECT_LT(compact_gc->GetCommittedBytes(), ovum::vm::runtime::ReservedRegion::GetPageSize());
+  EXPECT_EQ(SnapshotRepo(mm_.GetRepository()).size(), 1u);
+}
+
+TEST_F(GcTestSuite, CompactionWaitsForLazySweep) {
+  auto gc = std::make_unique<ovum::vm::runtime::MarkCompactGC>(4096, 2, std::chrono::microseconds::zero(), 0.1);
+  ovum::vm::runtime::MarkCompactGC* compact_gc = gc.get();
+  auto data = MakeFreshData(kDefaultHeapTargetBytes, std::move(gc));
+
+  for (int i = 0; i < 8; ++i) {
+    AllocateTestObject("Simple", data);
+  }
+
+  void* head = AllocateTestObject("WithRef", data);
+  SetRef(head, nullptr);
+  data.memory.global_variables.emplace_back(head);
+
+  CollectGarbage(data);
+
+  ASSERT_TRUE(compact_gc->HasPendingWork());
+  EXPECT_EQ(std::get<void*>(data.memory.global_variables.back()), head);
+  EXPECT_EQ(SnapshotRepo(mm_.GetRepository()).size(), 9u);
+
+  while (compact_gc->HasPendingWork()) {
+    auto step_res = data.memory_manager.CollectGarbageIfRequired(data);
+    ASSERT_TRUE(step_res.has_value());
+  }
+
+  void* moved_head = std::get<void*>(data.memory.global_variables.back());
+  EXPECT_LT(moved_head, head);
+  EXPECT_TRUE(RepoContains(mm_.GetRepository(), moved_head));
+  EXPECT_EQ(SnapshotRepo(mm_.GetRepository()).size(), 1u);
+}
+
+TEST_F(GcTestSuite, CompactingCollectorMarksIncrementally) {
+  auto gc = std::make_unique<ovum::vm::runtime::MarkCompactGC>(1024 * 1024, 0, std::chrono::microseconds(1), 0.1);
+  ovum::vm::runtime::MarkCompactGC* compact_gc = gc.get();
+  auto data = MakeFreshData(10, std::move(gc));
+
+  void* arr = AllocateTestObject("Array", data);
+  InitArray(arr);
+  data.memory.global_variables.emplace_back(arr);
+
+  for (int i = 0; i < 20000; ++i) {
+    AddToArray(arr, AllocateTestObject("Simple", data));
+  }
+
+  void* holder = AllocateTestObject("WithRef", data);
+  SetRef(holder, nullptr);
+  AddToArray(arr, holder);
+  AllocateTestObject("Simple", data);
+
+  auto gc_res = data.memory_manager.CollectGarbageIfRequired(data);
+  ASSERT_TRUE(gc_res.has_value());
+  ASSERT_TRUE(compact_gc->IsMarking());
+
+  void* fresh = AllocateTestObject("Simple", data);
+  data.memory_manager.WriteBarrier(fresh);
+  SetRef(holder, fresh);
+
+  while (compact_gc->HasPendingWork()) {
+    gc_res = data.memory_manager.CollectGarbageIfRequired(data);
+    ASSERT_TRUE(gc_res.has_value());
+  }
+
+  EXPECT_EQ(SnapshotRepo(mm_.GetRepository()).size(), 20003u);
+  EXPECT_TRUE(RepoContains(mm_.GetRepository(), fresh));
+}
+
+TEST_F(GcTestSuite, RootScanningVisitsSlotsInPlace) {
+  auto data = MakeFreshData();
+
+  data.memory.global_variables.emplace_back(AllocateTestObject("Simple", data));
+
+  for (int i = 0; i < 1000; ++i) {
+    ovum::vm::runtime::StackFrame frame;
+    frame.function_name = "_Deep_frame_" + std::to_string(i);
+    frame.local_variables = {static_cast<int64_t>(i), static_cast<void*>(nullptr), 1.5};
+    data.memory.stack_frames.push(std::move(frame));
+    data.memory.machine_stack.emplace(static_cast<int64_t>(i));
+  }
+
+  data.memory.stack_frames.top().local_variables[1] = AllocateTestObject("Simple", data);
+  data.memory.temporary_roots.emplace_back(AllocateTestObject("Simple", data));
+
+  // Copying a stack to enumerate it would hand the visitor slots of the copy; every slot must be the original one
+  std::unordered_set<const ovum::vm::runtime::Variable*> slots;
+  slots.insert(&data.memory.global_variables[0]);
+  slots.insert(&data.memory.temporary_roots[0]);
+
+  for (const ovum::vm::runtime::StackFrame& frame :
+       ovum::vm::runtime::detail::UnderlyingContainer(data.memory.stack_frames)) {
+    for (const ovum::vm::runtime::Variable& var : frame.local_variables) {
+      slots.insert(&var);
+    }
+  }
+
+  for (const ovum::vm::runtime::Variable& var :
+       ovum::vm::runtime::detail::UnderlyingContainer(data.memory.machine_stack)) {
+    slots.insert(&var);
+  }
+
+  size_t visited = 0;
+  size_t foreign = 0;
+  size_t objects = 0;
+
+  data.memory.ForEachRoot([&](ovum::vm::runtime::Variable& var) {
+    ++visited;
+
+    if (!slots.contains(&var)) {
+      ++foreign;
+    }
+
+    if (std::holds_alternative<void*>(var) && std::get<void*>(var) != nullptr) {
+      ++objects;
+    }
+  });
+
+  EXPECT_EQ(foreign, 0u);
+  EXPECT_EQ(visited, 1u + 3000u + 1000u + 1u);
+  EXPECT_EQ(objects, 3u);
+
+  while (!data.memory.stack_frames.empty()) {
+    data.memory.stack_frames.pop();
+  }
+}
+
+TEST_F(GcTestSuite, TemporaryRootsAndDeepFramesSurviveCollection) {
+  auto data = MakeFreshData();
+
+  for (int i = 0; i < 100; ++i) {
+    ovum::vm::runtime::StackFrame frame;
+    frame.local_variables.emplace_back(AllocateTestObject("Simple", data));
+    data.memory.stack_frames.push(std::move(frame));
+  }
+
+  void* temporary = AllocateTestObject("Simple", data);
+  data.memory.temporary_roots.emplace_back(temporary);
+  void* garbage = AllocateTestObject("Simple", data);
+
+  CollectGarbage(data);
+
+  EXPECT_TRUE(RepoContains(mm_.GetRepository(), temporary));
+  EXPECT_FALSE(RepoContains(mm_.GetRepository(), garbage));
+  EXPECT_EQ(SnapshotRepo(mm_.GetRepository()).size(), 101u);
+
+  data.memory.temporary_roots.pop_back();
+  CollectGarbage(data);
+
+  EXPECT_FALSE(RepoContains(mm_.GetRepository(), temporary));
+  EXPECT_EQ(SnapshotRepo(mm_.GetRepository()).size(), 100u);
+
+  while (!data.memory.stack_frames.empty()) {
+    data.memory.stack_frames.pop();
+  }
+}
+
+TEST_F(GcTestSuite, TriviallyDestructibleObjectsSkipDestructor) {
+  {
+    // The destructor is never registered, so running it would fail the collection
+    ovum::vm::runtime::VirtualTable vt("Trivial", sizeof(ovum::vm::runtime::ObjectDescriptor) + sizeof(int64_t));
+    vt.AddField("int", sizeof(ovum::vm::runtime::ObjectDescriptor));
+    vt.AddFunction("_destructor_<M>", "_Trivial_destructor_<M>");
+    vt.SetTriviallyDestructible(true);
+    ASSERT_TRUE(vtr_.Add(std::move(vt)).has_value());
+  }
+
+  auto data = MakeFreshData();
+
+  void* kept = AllocateTestObject("Trivial", data);
+  data.memory.global_variables.emplace_back(kept);
+
+  for (int i = 0; i < 1000; ++i) {
+    AllocateTestObject("Trivial", data);
+  }
+
+  void* simple_garbage = AllocateTestObject("Simple", data);
+
+  CollectGarbage(data);
+
+  EXPECT_TRUE(RepoContains(mm_.GetRepository(), kept));
+  EXPECT_FALSE(RepoContains(mm_.GetRepository(), simple_garbage));
+  EXPECT_EQ(SnapshotRepo(mm_.GetRepository()).size(), 1u);
+}
+
+TEST_F(GcTestSuite, DestructorIsResolvedOnce) {
+  auto data = MakeFreshData();
+
+  auto vt_res = vtr_.GetByName("Simple");
+  ASSERT_TRUE(vt_res.has_value());
+  EXPECT_EQ(vt_res.value()->GetCachedDestructor(), nullptr);
+
+  AllocateTestObject("Simple", data);
+  AllocateTestObject("Simple", data);
+  CollectGarbage(data);
+
+  auto dtor_res = fr_.GetByName("_Simple_destructor_<M>");
+  ASSERT_TRUE(dtor_res.has_value());
+  EXPECT_EQ(vt_res.value()->GetCachedDestructor(), dtor_res.value());
+  EXPECT_EQ(dtor_res.value()->GetExecutionCount(), 2u);
+}
+
+namespace {
+
+class CountingGC : public ovum::vm::runtime::MarkAndSweepGC {
+public:
+  explicit CountingGC(size_t& collections) : collections_(collections) {
+  }
+
+  std::expected<void, std::runtime_error> Collect(ovum::vm::execution_tree::PassedExecutionData& data) override {
+    ++collections_;
+    return MarkAndSweepGC::Collect(data);
+  }
+
+private:
+  size_t& collections_;
+};
+
+} // namespace
+
+TEST_F(GcTestSuite, LargeLiveSetDoesNotThrash) {
+  size_t collections = 0;
+  auto data = MakeFreshData(ovum::vm::runtime::HeapSizing{.initial_heap_bytes = 1024, .growth_factor = 2.0},
+                            std::make_unique<CountingGC>(collections));
+
+  void* arr = AllocateTestObject("Array", data);
+  InitArray(arr);
+  data.memory.global_variables.emplace_back(arr);
+
+  for (int i = 0; i < 20000; ++i) {
+    AddToArray(arr, AllocateTestObject("Simple", data));
+  }
+
+  auto gc_res = data.memory_manager.CollectGarbageIfRequired(data);
+  ASSERT_TRUE(gc_res.has_value());
+  ASSERT_EQ(collections, 1u);
+
+  const size_t live_bytes = mm_.GetAllocatedBytes();
+  EXPECT_EQ(mm_.GetHeapTarget(), live_bytes * 2);
+
+  // A fixed threshold below the live set would collect after every one of these safepoints
+  for (int i = 0; i < 1000; ++i) {
+    AllocateTestObject("Simple", data);
+    gc_res = data.memory_manager.CollectGarbageIfRequired(data);
+    ASSERT_TRUE(gc_res.has_value());
+  }
+
+  EXPECT_EQ(collections, 1u);
+  EXPECT_EQ(SnapshotRepo(mm_.GetRepository()).size(), 20001u + 1000u);
+}
+
+TEST_F(GcTestSuite, AllocationBeyondMaxHeapFails) {
+  auto data = MakeFreshData(ovum::vm::runtime::HeapSizing{.initial_heap_bytes = 64, .max_heap_bytes = 256},
+                            std::make_unique<ovum::vm::runtime::MarkAndSweepGC>());
+
+  auto vt_res = data.virtual_table_repository.GetByName("Simple");
+  auto idx_res = data.virtual_table_repository.GetIndexByName("Simple");
+  ASSERT_TRUE(vt_res.has_value());
+  ASSERT_TRUE(idx_res.has_value());
+
+  const size_t object_size = vt_res.value()->GetSize();
+  size_t allocated = 0;
+
+  std::expected<void*, std::runtime_error> alloc_res =
+      data.memory_manager.AllocateObject(*vt_res.value(), static_cast<uint32_t>(idx_res.value()), data);
+
+  while (alloc_res.has_value()) {
+    ++allocated;
+    alloc_res = data.memory_manager.AllocateObject(*vt_res.value(), static_cast<uint32_t>(idx_res.value()), data);
+  }
+
+  EXPECT_NE(std::string(alloc_res.error().what()).find("live objects " + std::to_string(allocated)), std::string::npos);
+
+  EXPECT_EQ(allocated, 256 / object_size);
+  EXPECT_LE(mm_.GetAllocatedBytes(), 256u);
+  EXPECT_LT(mm_.GetHeapTarget(), 256u);
+
+  CollectGarbage(data);
+
+  EXPECT_EQ(mm_.GetAllocatedBytes(), 0u);
+  EXPECT_TRUE(data.memory_manager.AllocateObject(*vt_res.value(), static_cast<uint32_t>(idx_res.value()), data)
+                  .has_value());
+}
+
+TEST_F(GcTestSuite, HeapLimitDrainsLazySweepBeforeFailing) {
+  {
+    ovum::vm::runtime::VirtualTable vt("Big", 64);
+    vt.SetTriviallyDestructible(true);
+    ASSERT_TRUE(vtr_.Add(std::move(vt)).has_value());
+  }
+
+  auto data = MakeFreshData(ovum::vm::runtime::HeapSizing{.initial_heap_bytes = 64, .max_heap_bytes = 256},
+                            std::make_unique<ovum::vm::runtime::MarkAndSweepGC>(1));
+
+  while (mm_.GetAllocatedBytes() < 256) {
+    AllocateTestObject("Simple", data);
+  }
+
+  CollectGarbage(data);
+  ASSERT_EQ(mm_.GetAllocatedBytes(), 256u);
+
+  // One lazy step frees a single small object, far too little for the request on its own
+  void* big = AllocateTestObject("Big", data);
+
+  EXPECT_TRUE(RepoContains(mm_.GetRepository(), big));
+  EXPECT_EQ(SnapshotRepo(mm_.GetRepository()).size(), 1u);
+  EXPECT_EQ(mm_.GetAllocatedBytes(), 64u);
+}
+
+TEST_F(GcTestSuite, IncrementalMarkFinishesNearHeapLimit) {
+  auto gc = std::make_unique<ovum::vm::runtime::MarkAndSweepGC>(0, std::chrono::microseconds(1));
+  ovum::vm::runtime::MarkAndSweepGC* collector = gc.get();
+  auto data = MakeFreshData(ovum::vm::runtime::HeapSizing{.initial_heap_bytes = 10, .max_heap_bytes = 256 * 1024},
+                            std::move(gc));
+
+  void* arr = AllocateTestObject("Array", data);
+  InitArray(arr);
+  data.memory.global_variables.emplace_back(arr);
+
+  for (int i = 0; i < 20000; ++i) {
+    AddToArray(arr, AllocateTestObject("Simple", data));
+  }
+
+  auto gc_res = data.memory_manager.CollectGarbageIfRequired(data);
+  ASSERT_TRUE(gc_res.has_value());
+  ASSERT_TRUE(collector->IsMarking());
+  ASSERT_FALSE(mm_.IsNearHeapLimit());
+
+  void* garbage = nullptr;
+
+  while (!mm_.IsNearHeapLimit()) {
+    garbage = AllocateTestObject("Simple", data);
+  }
+
+  gc_res = data.memory_manager.CollectGarbageIfRequired(data);
+  ASSERT_TRUE(gc_res.has_value());
+
+  EXPECT_FALSE(collector->IsMarking());
+  EXPECT_FALSE(RepoContains(mm_.GetRepository(), garbage));
+  EXPECT_FALSE(mm_.IsNearHeapLimit());
+  EXPECT_EQ(SnapshotRepo(mm_.GetRepository()).size(), 20001u);
+}
+
+TEST_F(GcTestSuite, ExternalMemoryTriggersCollection) {
+  size_t collections = 0;
+  auto data = MakeFreshData(ovum::vm::runtime::HeapSizing{.initial_heap_bytes = 1024, .growth_factor = 2.0},
+                            std::make_unique<CountingGC>(collections));
+
+  void* arr = AllocateTestObject("Array", data);
+  InitArray(arr);
+  data.memory.global_variables.emplace_back(arr);
+
+  auto gc_res = data.memory_manager.CollectGarbageIfRequired(data);
+  ASSERT_TRUE(gc_res.has_value());
+  ASSERT_EQ(collections, 0u);
+
+  // The object itself is tiny, only its off-heap payload pushes the heap past the target
+  data.memory_manager.ReportExternalMemory(arr, 4096);
+  gc_res = data.memory_manager.CollectGarbageIfRequired(data);
+  ASSERT_TRUE(gc_res.has_value());
+
+  EXPECT_EQ(collections, 1u);
+  EXPECT_EQ(mm_.GetExternalBytes(), 4096u);
+  EXPECT_EQ(mm_.GetHeapTarget(), (mm_.GetAllocatedBytes() + 4096u) * 2);
+}
+
+TEST_F(GcTestSuite, ExternalMemoryIsTrackedPerVtable) {
+  auto data = MakeFreshData();
+
+  auto array_idx = data.virtual_table_repository.GetIndexByName("Array");
+  auto simple_idx = data.virtual_table_repository.GetIndexByName("Simple");
+  ASSERT_TRUE(array_idx.has_value());
+  ASSERT_TRUE(simple_idx.has_value());
+
+  void* arr = AllocateTestObject("Array", data);
+  InitArray(arr);
+  data.memory_manager.ReportExternalMemory(arr, 100);
+  data.memory_manager.ReportExternalMemory(arr, 300);
+
+  EXPECT_EQ(mm_.GetExternalBytes(), 300u);
+  EXPECT_EQ(mm_.GetExternalBytes(static_cast<uint32_t>(array_idx.value())), 300u);
+  EXPECT_EQ(mm_.GetExternalBytes(static_cast<uint32_t>(simple_idx.value())), 0u);
+
+  CollectGarbage(data);
+
+  EXPECT_EQ(mm_.GetExternalBytes(), 0u);
+  EXPECT_EQ(mm_.GetExternalBytes(static_cast<uint32_t>(array_idx.value())), 0u);
+}
+
+TEST_F(GcTestSuite, FastTeardownRunsOnlyResourceDestructors) {
+  {
+    // The destructor is never registered, so running it would fail the teardown
+    ovum::vm::runtime::VirtualTable vt("HeapOnly", sizeof(ovum::vm::runtime::ObjectDescriptor) + sizeof(int64_t));
+    vt.AddFunction("_destructor_<M>", "_HeapOnly_destructor_<M>");
+    vt.SetHeapOnly(true);
+    ASSERT_TRUE(vtr_.Add(std::move(vt)).has_value());
+  }
+
+  auto data = MakeFreshData();
+
+  const size_t heap_only_size = sizeof(ovum::vm::runtime::ObjectDescriptor) + sizeof(int64_t);
+
+  for (int i = 0; i < 100; ++i) {
+    fast_teardown_leftovers_.emplace_back(AllocateTestObject("HeapOnly", data), heap_only_size);
+  }
+
+  AllocateTestObject("Simple", data);
+  AllocateTestObject("Simple", data);
+
+  auto clear_res = data.memory_manager.Clear(data, ovum::vm::runtime::TeardownMode::kFast);
+  ASSERT_TRUE(clear_res.has_value()) << clear_res.error().what();
+
+  auto dtor_res = fr_.GetByName("_Simple_destructor_<M>");
+  ASSERT_TRUE(dtor_res.has_value());
+  EXPECT_EQ(dtor_res.value()->GetExecutionCount(), 2u);
+  EXPECT_EQ(mm_.GetRepository().GetCount(), 0u);
+  EXPECT_EQ(mm_.GetAllocatedBytes(), 0u);
+}
+
+TEST_F(GcTestSuite, SoftReferenceClearedOnlyNearHeapLimit) {
+  {
+    ovum::vm::runtime::VirtualTable vt("Soft",
+                                       sizeof(ovum::vm::runtime::ObjectDescriptor) + sizeof(void*),
+                                       std::make_unique<ovum::vm::runtime::WeakReferenceScanner>());
+    vt.SetTriviallyDestructible(true);
+    vt.SetReferenceStrength(ovum::vm::runtime::ReferenceStrength::kSoft);
+    ASSERT_TRUE(vtr_.Add(std::move(vt)).has_value());
+  }
+
+  auto data = MakeFreshData(ovum::vm::runtime::HeapSizing{.initial_heap_bytes = 64, .max_heap_bytes = 4096},
+                            std::make_unique<ovum::vm::runtime::MarkAndSweepGC>());
+
+  void* soft = AllocateTestObject("Soft", data);
+  data.memory.global_variables.emplace_back(soft);
+  void* cached = AllocateTestObject("WithRef", data);
+  SetRef(cached, nullptr);
+  ovum::vm::runtime::WeakReferenceScanner::Referent(soft) = cached;
+
+  CollectGarbage(data);
+
+  ASSERT_FALSE(mm_.IsNearHeapLimit());
+  EXPECT_EQ(ovum::vm::runtime::WeakReferenceScanner::Referent(soft), cached);
+  EXPECT_TRUE(RepoContains(mm_.GetRepository(), cached));
+
+  while (!mm_.IsNearHeapLimit()) {
+    data.memory.global_variables.emplace_back(AllocateTestObject("Simple", data));
+  }
+
+  CollectGarbage(data);
+
+  EXPECT_EQ(ovum::vm::runtime::WeakReferenceScanner::Referent(soft), nullptr);
+  EXPECT_FALSE(RepoContains(mm_.GetRepository(), cached));
+}
+
+TEST_F(GcTestSuite, IdlePointCollectsAboveFractionOfTarget) {
+  size_t collections = 0;
+  auto data = MakeFreshData(ovum::vm::runtime::HeapSizing{.initial_heap_bytes = 1024, .idle_collection_fraction = 0.5},
+                            std::make_unique<CountingGC>(collections));
+
+  void* garbage = AllocateTestObject("Simple", data);
+
+  auto idle_res = data.memory_manager.CollectGarbageWhileIdle(data, std::chrono::seconds(1));
+  ASSERT_TRUE(idle_res.has_value());
+  EXPECT_EQ(collections, 0u);
+
+  while (mm_.GetAllocatedBytes() * 2 < mm_.GetHeapTarget()) {
+    AllocateTestObject("Simple", data);
+  }
+
+  ASSERT_LE(mm_.GetAllocatedBytes(), mm_.GetHeapTarget());
+  idle_res = data.memory_manager.CollectGarbageWhileIdle(data, std::chrono::seconds(1));
+  ASSERT_TRUE(idle_res.has_value());
+
+  EXPECT_EQ(collections, 1u);
+  EXPECT_FALSE(RepoContains(mm_.GetRepository(), garbage));
+  EXPECT_EQ(mm_.GetAllocatedBytes(), 0u);
+}
+
+TEST_F(GcTestSuite, TriviallyDestructibleGarbageIsFreedInBackground) {
+  {
+    ovum::vm::runtime::VirtualTable vt("Trivial", sizeof(ovum::vm::runtime::ObjectDescriptor) + sizeof(int64_t));
+    vt.AddField("int", sizeof(ovum::vm::runtime::ObjectDescriptor));
+    vt.SetTriviallyDestructible(true);
+    ASSERT_TRUE(vtr_.Add(std::move(vt)).has_value());
+  }
+
+  auto data = MakeFreshData();
+
+  for (int i = 0; i < 1000; ++i) {
+    AllocateTestObject("Trivial", data);
+  }
+
+  CollectGarbage(data);
+
+  // Accounting happens on the VM thread, only the free() calls are deferred
+  EXPECT_EQ(SnapshotRepo(mm_.GetRepository()).size(), 0u);
+  EXPECT_EQ(mm_.GetAllocatedBytes(), 0u);
+
+  mm_.WaitForBackgroundFrees();
+  EXPECT_EQ(mm_.GetBackgroundFreedObjects(), 1000u);
+}
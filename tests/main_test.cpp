@@ -23,7 +23,16 @@ const std::string kHelpMessage =
     "\n\nOPTIONS:\n"
     "-f,  --file=<CompositeString>:  Path to the bytecode file\n"
     "-j,  --jit-boundary=<unsigned long long>:  JIT compilation boundary [default = 100000]\n"
-    "-m,  --max-objects=<unsigned long long>:  Maximum number of objects to keep in memory [default = 10000]\n\n"
+    "-i,  --gc-initial-heap=<unsigned long long>:  Heap bytes that trigger the first GC [default = 4194304]\n"
+    "-g,  --gc-growth-percent=<unsigned long long>:  Heap target after GC, percent of live bytes [default = 200]\n"
+    "-m,  --gc-max-heap=<unsigned long long>:  Hard heap limit in bytes, 0 for no limit [default = 0]\n"
+    "-s,  --gc-sweep-batch=<unsigned long long>:  Objects swept per lazy GC step, 0 for eager sweep [default = 0]\n"
+    "-u,  --gc-slice-us=<unsigned long long>:  Incremental marking slice in microseconds, 0 to disable [default = 0]\n"
+    "-c,  --gc-compact-arena=<unsigned long long>:  Compacting heap size in bytes, 0 to disable [default = 0]\n"
+    "-r,  --fusion-report:  Print allocations fused with the command that consumes them\n"
+    "-p,  --pack-fields:  Reorder user class fields by alignment to remove padding\n"
+    "-l,  --layout-report:  Print per-class object size savings of --pack-fields\n"
+    "-t,  --fast-teardown:  At exit run only destructors that release non-memory resources\n\n"
     "-h,  --help:  Display this help and exit\n";
 
 TEST_F(ProjectIntegrationTestSuite, NegitiveOutputTest1) {
@@ -267,7 +276,7 @@ TEST_F(ProjectIntegrationTestSuite, MemcheckTest) {
   std::string cmd = "ovum-vm -f \"";
   cmd += test_file.string();
   cmd += "\"";
-  cmd += " -m 10000";
+  cmd += " -i 65536";
 
   if (!test_data.arguments.empty()) {
     cmd += " -- ";
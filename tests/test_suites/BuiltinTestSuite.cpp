@@ -9,6 +9,7 @@
 #include "lib/runtime/ByteArray.hpp"
 #include "lib/runtime/MemoryManager.hpp"
 #include "lib/runtime/ObjectDescriptor.hpp"
+#include "lib/runtime/String.hpp"
 
 using ovum::vm::execution_tree::CreateBooleanCommandByName;
 using ovum::vm::execution_tree::CreateFloatCommandByName;
@@ -112,8 +113,8 @@ void* BuiltinTestSuite::MakeString(const std::string& value) {
     return nullptr;
 
   void* obj = obj_res.value();
-  auto* str_ptr = GetDataPointer<std::string>(obj);
-  new (str_ptr) std::string(value);
+  auto* str_ptr = GetDataPointer<ovum::vm::runtime::String>(obj);
+  new (str_ptr) ovum::vm::runtime::String(value);
   return obj;
 }
 
@@ -248,8 +249,8 @@ void BuiltinTestSuite::ExpectTopStringEquals(const std::string& expected) {
   ASSERT_FALSE(memory_.machine_stack.empty());
   auto var = memory_.machine_stack.top();
   ASSERT_TRUE(std::holds_alternative<void*>(var));
-  auto* str_ptr = GetDataPointer<std::string>(std::get<void*>(var));
-  EXPECT_EQ(*str_ptr, expected);
+  auto* str_ptr = GetDataPointer<ovum::vm::runtime::String>(std::get<void*>(var));
+  EXPECT_EQ(str_ptr->View(), expected);
 }
 
 void BuiltinTestSuite::ExpectTopNullableHasValue(bool has_value) {
@@ -59,7 +59,6 @@ struct BuiltinTestSuite : public testing::Test {
   void CleanupObjects();
   void DestroyObject(void* obj);
 
-  constexpr static size_t kDefaultMaxObjects = 10000;
 
   // Repositories for fixtures
   ovum::vm::runtime::RuntimeMemory memory_{};
@@ -68,8 +67,7 @@ struct BuiltinTestSuite : public testing::Test {
   std::stringstream input_stream_;
   std::stringstream output_stream_;
   std::stringstream error_stream_;
-  ovum::vm::runtime::MemoryManager memory_manager_{std::make_unique<ovum::vm::runtime::MarkAndSweepGC>(),
-                                                   kDefaultMaxObjects};
+  ovum::vm::runtime::MemoryManager memory_manager_{std::make_unique<ovum::vm::runtime::MarkAndSweepGC>()};
   ovum::vm::execution_tree::PassedExecutionData data_;
 };
 
@@ -21,6 +21,10 @@ ovum::bytecode::parser::BytecodeParser BytecodeParserTestSuite::CreateParserWith
   return {nullptr, 0, command_factory_};
 }
 
+ovum::bytecode::parser::BytecodeParser BytecodeParserTestSuite::CreateParserWithFieldPacking() {
+  return {nullptr, 0, command_factory_, true};
+}
+
 std::vector<ovum::TokenPtr> BytecodeParserTestSuite::TokenizeString(const std::string& input) {
   ovum::bytecode::lexer::BytecodeLexer lexer(input);
   auto result = lexer.Tokenize();
@@ -15,9 +15,11 @@
 #include "lib/execution_tree/FunctionRepository.hpp"
 #include "lib/execution_tree/IFunctionExecutable.hpp"
 #include "lib/runtime/RuntimeMemory.hpp"
+#include "lib/runtime/StringPool.hpp"
 #include "lib/runtime/VirtualTableRepository.hpp"
 
 #include "lib/executor/PlaceholderJitExecutorFactory.hpp"
+#include "lib/executor/builtin_factory.hpp"
 
 struct BytecodeParserTestSuite : public testing::Test {
   static constexpr size_t kJitBoundary = 10;
@@ -27,6 +29,7 @@ struct BytecodeParserTestSuite : public testing::Test {
   // Parser creation helpers
   ovum::bytecode::parser::BytecodeParser CreateParserWithJit(size_t jit_boundary = kJitBoundary);
   ovum::bytecode::parser::BytecodeParser CreateParserWithoutJit();
+  ovum::bytecode::parser::BytecodeParser CreateParserWithFieldPacking();
 
   // Token creation helpers
   std::vector<ovum::TokenPtr> TokenizeString(const std::string& input);
@@ -5,11 +5,21 @@
 #include "lib/executor/builtin_factory.hpp"
 
 GcTestSuite::GcTestSuite() :
-    vtr_(), fr_(), mm_(std::make_unique<ovum::vm::runtime::MarkAndSweepGC>(), kDefaultGCThreshold), rm_() {
+    vtr_(), fr_(), mm_(std::make_unique<ovum::vm::runtime::MarkAndSweepGC>(), {.initial_heap_bytes = kDefaultHeapTargetBytes}), rm_() {
 }
 
-ovum::vm::execution_tree::PassedExecutionData GcTestSuite::MakeFreshData(uint64_t gc_threshold) {
-  mm_ = ovum::vm::runtime::MemoryManager(std::make_unique<ovum::vm::runtime::MarkAndSweepGC>(), gc_threshold);
+ovum::vm::execution_tree::PassedExecutionData GcTestSuite::MakeFreshData(uint64_t heap_target_bytes) {
+  return MakeFreshData(heap_target_bytes, std::make_unique<ovum::vm::runtime::MarkAndSweepGC>());
+}
+
+ovum::vm::execution_tree::PassedExecutionData GcTestSuite::MakeFreshData(
+    uint64_t heap_target_bytes, std::unique_ptr<ovum::vm::runtime::IGarbageCollector> gc) {
+  return MakeFreshData(ovum::vm::runtime::HeapSizing{.initial_heap_bytes = heap_target_bytes}, std::move(gc));
+}
+
+ovum::vm::execution_tree::PassedExecutionData GcTestSuite::MakeFreshData(
+    ovum::vm::runtime::HeapSizing sizing, std::unique_ptr<ovum::vm::runtime::IGarbageCollector> gc) {
+  mm_ = ovum::vm::runtime::MemoryManager(std::move(gc), sizing);
   ovum::vm::execution_tree::PassedExecutionData data{.memory = rm_,
                                                      .virtual_table_repository = vtr_,
                                                      .function_repository = fr_,
@@ -44,7 +54,7 @@ void GcTestSuite::SetUp() {
   RegisterNoOpDestructors();
 
   auto gc = std::make_unique<ovum::vm::runtime::MarkAndSweepGC>();
-  mm_ = ovum::vm::runtime::MemoryManager(std::move(gc), kDefaultGCThreshold);
+  mm_ = ovum::vm::runtime::MemoryManager(std::move(gc), {.initial_heap_bytes = kDefaultHeapTargetBytes});
 }
 
 void GcTestSuite::TearDown() {
@@ -56,6 +66,12 @@ void GcTestSuite::TearDown() {
                                                      .output_stream = std::cout,
                                                      .error_stream = std::cerr};
   auto res = data.memory_manager.Clear(data);
+
+  for (const auto& [obj, size] : fast_teardown_leftovers_) {
+    std::allocator<char>().deallocate(static_cast<char*>(obj), size);
+  }
+
+  fast_teardown_leftovers_.clear();
   ASSERT_TRUE(res.has_value()) << "Clear failed: " << res.error().what();
 }
 
@@ -177,6 +193,11 @@ void GcTestSuite::SetRef(void* obj, void* target) {
   *ptr = target;
 }
 
+void* GcTestSuite::GetRef(void* obj) const {
+  void** ptr = reinterpret_cast<void**>(reinterpret_cast<char*>(obj) + sizeof(ovum::vm::runtime::ObjectDescriptor));
+  return *ptr;
+}
+
 void GcTestSuite::InitArray(void* array_obj) {
   auto* vec = reinterpret_cast<std::vector<void*>*>(reinterpret_cast<char*>(array_obj) +
                                                     sizeof(ovum::vm::runtime::ObjectDescriptor));
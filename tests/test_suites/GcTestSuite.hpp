@@ -7,11 +7,13 @@
 #include <memory>
 #include <string>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "lib/execution_tree/ExecutionResult.hpp"
 #include "lib/execution_tree/FunctionRepository.hpp"
 #include "lib/execution_tree/PassedExecutionData.hpp"
+#include "lib/runtime/HeapSizing.hpp"
 #include "lib/runtime/MemoryManager.hpp"
 #include "lib/runtime/ObjectDescriptor.hpp"
 #include "lib/runtime/ObjectRepository.hpp"
@@ -21,7 +23,7 @@
 #include "lib/runtime/gc/reference_scanners/ArrayReferenceScanner.hpp"
 #include "lib/runtime/gc/reference_scanners/DefaultReferenceScanner.hpp"
 
-const uint64_t kDefaultGCThreshold = 100;
+const uint64_t kDefaultHeapTargetBytes = 100;
 
 ovum::vm::execution_tree::ExecutionResult NoOpDestructor(ovum::vm::execution_tree::PassedExecutionData& data);
 
@@ -32,7 +34,11 @@ protected:
   void SetUp() override;
   void TearDown() override;
 
-  ovum::vm::execution_tree::PassedExecutionData MakeFreshData(uint64_t gc_threshold = kDefaultGCThreshold);
+  ovum::vm::execution_tree::PassedExecutionData MakeFreshData(uint64_t heap_target_bytes = kDefaultHeapTargetBytes);
+  ovum::vm::execution_tree::PassedExecutionData MakeFreshData(
+      uint64_t heap_target_bytes, std::unique_ptr<ovum::vm::runtime::IGarbageCollector> gc);
+  ovum::vm::execution_tree::PassedExecutionData MakeFreshData(
+      ovum::vm::runtime::HeapSizing sizing, std::unique_ptr<ovum::vm::runtime::IGarbageCollector> gc);
 
   void RegisterTestVtables();
   void RegisterNoOpDestructors();
@@ -47,6 +53,8 @@ protected:
 
   void SetRef(void* obj, void* target);
 
+  void* GetRef(void* obj) const;
+
   void InitArray(void* array_obj);
 
   void AddToArray(void* array_obj, void* item);
@@ -58,6 +66,8 @@ protected:
   ovum::vm::execution_tree::FunctionRepository fr_;
   ovum::vm::runtime::MemoryManager mm_;
   ovum::vm::runtime::RuntimeMemory rm_;
+  // Objects a fast teardown leaves to the operating system; released by TearDown so leak checkers stay quiet
+  std::vector<std::pair<void*, size_t>> fast_teardown_leftovers_;
 };
 
 #endif // GC_TEST_SUITE_HPP